@@ -65,9 +65,15 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         get_clause(x->conds, query->conds);
         check_clause({x->tab_name}, query->conds);        
     } else if (auto x = std::dynamic_pointer_cast<ast::InsertStmt>(parse)) {
-        // 处理insert 的values值
-        for (auto &sv_val : x->vals) {
-            query->values.push_back(convert_sv_value(sv_val));
+        // 处理insert 的values值，多行时按行依次存放
+        size_t num_cols = sm_manager_->db_.get_table(x->tab_name).cols.size();
+        for (auto &row : x->rows) {
+            if (row.size() != num_cols) {
+                throw InvalidValueCountError();
+            }
+            for (auto &sv_val : row) {
+                query->values.push_back(convert_sv_value(sv_val));
+            }
         }
     } else {
         // do nothing
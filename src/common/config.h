@@ -11,8 +11,11 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <atomic>
+#include <cerrno>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <iostream>
 #include <string>
 
 #define BUFFER_LENGTH 8192
@@ -35,8 +38,29 @@ static constexpr int HEADER_PAGE_ID = 0;                                      //
 static constexpr int PAGE_SIZE = 4096;                                        // size of a data page in byte  4KB
 static constexpr int BUFFER_POOL_SIZE = 65536;                                // size of buffer pool 256MB
 // static constexpr int BUFFER_POOL_SIZE = 262144;                                // size of buffer pool 1GB
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;                     // frame arena is mapped in huge page units
+static constexpr int BUFFER_POOL_INSTANCES = 16;                              // number of buffer pool instances
+static constexpr int MIN_FRAMES_PER_INSTANCE = 1024;                          // min frames of each buffer pool instance
+static constexpr size_t BULK_READ_RING_SIZE = 64;                            // ring of a bulk read strategy 256KB
+static constexpr size_t BULK_WRITE_RING_SIZE = 4096;                          // ring of a bulk write strategy 16MB
+static constexpr int BULK_READ_SCAN_THRESHOLD = 4;                            // scans larger than 1/4 of the pool use a ring
+static constexpr size_t PAGE_CLEANER_TARGET_CLEAN = BUFFER_POOL_SIZE / 16;     // clean frames kept by the page cleaner
+static constexpr size_t PAGE_CLEANER_MAX_PAGES = 1024;                        // max pages written per page cleaner round
+static constexpr std::chrono::milliseconds PAGE_CLEANER_INTERVAL{10};         // interval between page cleaner rounds
+static constexpr size_t PREFETCH_QUEUE_LIMIT = 64;                           // pending prefetch requests
+static constexpr int SCAN_READAHEAD_PAGES = 32;                               // read-ahead window of a sequential scan
+static constexpr int MAX_SCAN_READAHEAD_PAGES = 4096;                         // largest window accepted from RMDB_SCAN_READAHEAD
+static constexpr int WARM_UP_RUN_PAGES = 64;                                  // max pages per read of the buffer pool warm-up
+static constexpr int FILE_EXTENT_PAGES = 256;                                 // data files are preallocated in 1MB extents
+static constexpr int MAX_EXTENT_PAGES = 65536;                                // largest extent accepted from RMDB_FILE_EXTENT_PAGES
+static constexpr int COMPRESSED_SECTOR_SIZE = 512;                            // compressed pages are stored in 512B sectors
+static constexpr long MAX_DISK_LATENCY_US = 1000000;                          // largest injected latency of a latency backend
+static constexpr long MAX_DISK_BANDWIDTH_MB = 1024 * 1024;                    // largest bandwidth of a latency backend
+static constexpr unsigned ASYNC_IO_QUEUE_DEPTH = 64;                        // in-flight I/Os of an async I/O engine
+static constexpr unsigned ASYNC_IO_THREADS = 4;                             // workers of the thread-pool I/O engine
 static constexpr int LOG_BUFFER_SIZE = (1024 * PAGE_SIZE);                    // size of a log buffer in byte
 static constexpr int BUCKET_SIZE = 50;                                        // size of extendible hash bucket
+static constexpr size_t TUPLE_ARENA_BLOCK_SIZE = 64 * 1024;                    // block size of a per-statement tuple arena
 
 using frame_id_t = int32_t;  // frame id type, 帧页ID, 页在BufferPool中的存储单元称为帧,一帧对应一页
 using page_id_t = int32_t;   // page id type , 页ID
@@ -49,7 +73,50 @@ using timestamp_t = int32_t;  // timestamp type, used for transaction concurrenc
 // log file
 static const std::string LOG_FILE_NAME = "db.log";
 
-// replacer
+// replacer, "LRU", "CLOCK" or "LRUK"
 static const std::string REPLACER_TYPE = "LRU";
+static constexpr size_t LRUK_K = 2;                                           // K of LRU-K replacer
+static constexpr size_t LRUK_CORRELATED_PERIOD = 2;                           // accesses within this many ticks count as one
 
 static const std::string DB_META_NAME = "db.meta";
+
+// resident pages of the buffer pool saved by close_db and preloaded by open_db
+static const std::string BUFFER_POOL_DUMP_NAME = "buffer_pool.dump";
+
+// page mapping table of a compressed data file, stored next to the file as <file><suffix>
+static const std::string PAGE_MAP_SUFFIX = ".pmap";
+
+/**
+ * @description: 读取启动时的配置项，存在环境变量RMDB_<name>时以其值覆盖默认值
+ * @return {string} 配置项的值
+ * @param {string} &name 配置项名称，例如REPLACER
+ * @param {string} &default_value 默认值
+ */
+inline std::string get_config(const std::string &name, const std::string &default_value) {
+    const char *value = getenv(("RMDB_" + name).c_str());
+    return value != nullptr ? std::string(value) : default_value;
+}
+
+/**
+ * @description: 读取整数类型的启动配置项，环境变量RMDB_<name>不是[min_value, max_value]内的整数时打印警告并使用默认值
+ * @return {long} 配置项的值
+ * @param {string} &name 配置项名称，例如PAGE_CLEANER_TARGET
+ * @param {long} default_value 默认值
+ * @param {long} min_value 允许的最小值
+ * @param {long} max_value 允许的最大值
+ */
+inline long get_config_int(const std::string &name, long default_value, long min_value, long max_value) {
+    const char *value = getenv(("RMDB_" + name).c_str());
+    if (value == nullptr) {
+        return default_value;
+    }
+    char *end = nullptr;
+    errno = 0;
+    long parsed = strtol(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || parsed < min_value || parsed > max_value) {
+        std::cerr << "Warning: ignoring RMDB_" << name << "=" << value << ", expected an integer in [" << min_value
+                  << ", " << max_value << "], using " << default_value << std::endl;
+        return default_value;
+    }
+    return parsed;
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * @description: 按指针递增分配的内存池，用于一条语句执行过程中产生的元组。
+ * 分配的内存不能单独释放，在reset或内存池析构时一起释放。不是线程安全的
+ */
+class TupleArena {
+   public:
+    explicit TupleArena(size_t block_size = TUPLE_ARENA_BLOCK_SIZE) : block_size_(block_size) {}
+
+    TupleArena(const TupleArena &) = delete;
+    TupleArena &operator=(const TupleArena &) = delete;
+
+    /**
+     * @description: 分配size个字节，按8字节对齐。超过块大小的请求单独分配
+     * @return {char*} 在reset之前有效的内存
+     */
+    char *allocate(size_t size) {
+        size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        allocated_bytes_ += size;
+        if (size > block_size_) {
+            large_blocks_.push_back(std::make_unique<char[]>(size));
+            return large_blocks_.back().get();
+        }
+        if (size > remaining_) {
+            blocks_.push_back(std::make_unique<char[]>(block_size_));
+            cur_ = blocks_.back().get();
+            remaining_ = block_size_;
+        }
+        char *ptr = cur_;
+        cur_ += size;
+        remaining_ -= size;
+        return ptr;
+    }
+
+    /**
+     * @description: 释放所有已分配的内存，保留第一个块供之后的分配重用
+     */
+    void reset() {
+        large_blocks_.clear();
+        if (blocks_.size() > 1) {
+            blocks_.resize(1);
+        }
+        cur_ = blocks_.empty() ? nullptr : blocks_.front().get();
+        remaining_ = blocks_.empty() ? 0 : block_size_;
+        allocated_bytes_ = 0;
+    }
+
+    /**
+     * @description: 上次reset以来分配的字节数
+     */
+    size_t get_allocated_bytes() const { return allocated_bytes_; }
+
+   private:
+    static constexpr size_t ALIGNMENT = 8;
+
+    size_t block_size_;
+    std::vector<std::unique_ptr<char[]>> blocks_;        // 大小为block_size_的块，最后一个是当前块
+    std::vector<std::unique_ptr<char[]>> large_blocks_;  // 超过块大小的单独分配
+    char *cur_ = nullptr;                                // 当前块中下一次分配的位置
+    size_t remaining_ = 0;                               // 当前块剩余的字节数
+    size_t allocated_bytes_ = 0;
+};
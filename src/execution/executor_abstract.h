@@ -19,7 +19,7 @@ class AbstractExecutor {
    public:
     Rid _abstract_rid;
 
-    Context *context_;
+    Context *context_ = nullptr;
 
     virtual ~AbstractExecutor() = default;
 
@@ -42,6 +42,21 @@ class AbstractExecutor {
 
     virtual std::unique_ptr<RmRecord> Next() = 0;
 
+    /**
+     * @description: 与Next相同，但返回记录的视图，能直接引用页面或内部缓冲区的执行器不复制记录。
+     * 默认实现包装Next的结果
+     */
+    virtual RecordView NextView() {
+        std::shared_ptr<RmRecord> rec = Next();
+        if (rec == nullptr) return RecordView();
+        return RecordView(rec->data, rec->size, rec);
+    }
+
+    /**
+     * @description: 本条语句的元组内存池，没有Context时返回nullptr
+     */
+    TupleArena *get_arena() const { return context_ == nullptr ? nullptr : &context_->arena_; }
+
     virtual ColMeta get_col_offset(const TabCol &target) { return ColMeta();};
 
     std::vector<ColMeta>::const_iterator get_col(const std::vector<ColMeta> &rec_cols, const TabCol &target) {
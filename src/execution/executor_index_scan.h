@@ -31,6 +31,7 @@ class IndexScanExecutor : public AbstractExecutor {
 
     Rid rid_;
     std::unique_ptr<IxScan> scan_;              // 索引扫描器
+    RecordView rec_;                            // rid_指向的记录，持有其所在页面的pin
     IxIndexHandle *ih_;                         // 索引句柄
 
     SmManager *sm_manager_;
@@ -104,12 +105,13 @@ class IndexScanExecutor : public AbstractExecutor {
         
         while (!scan_->is_end()) {
             rid_ = scan_->rid();
-            auto rec = fh_->get_record(rid_, context_);
-            if (eval_conds(cols_, fed_conds_, rec.get())) {
-                break;
+            rec_ = fh_->get_record_view(rid_, context_);
+            if (eval_conds(cols_, fed_conds_, rec_.data())) {
+                return;
             }
             scan_->next();
         }
+        rec_ = RecordView();
     }
     
     void nextTuple() override {
@@ -118,17 +120,23 @@ class IndexScanExecutor : public AbstractExecutor {
         scan_->next();
         while (!scan_->is_end()) {
             rid_ = scan_->rid();
-            auto rec = fh_->get_record(rid_, context_);
-            if (eval_conds(cols_, fed_conds_, rec.get())) {
-                break;
+            rec_ = fh_->get_record_view(rid_, context_);
+            if (eval_conds(cols_, fed_conds_, rec_.data())) {
+                return;
             }
             scan_->next();
         }
+        rec_ = RecordView();
     }
     
     std::unique_ptr<RmRecord> Next() override {
         if (is_end()) return nullptr;
-        return fh_->get_record(rid_, context_);
+        return rec_.materialize(get_arena());
+    }
+
+    RecordView NextView() override {
+        if (is_end()) return RecordView();
+        return rec_;
     }
     
     Rid &rid() override { return rid_; }
@@ -169,10 +177,10 @@ private:
         }
     }
 
-    bool eval_cond(const std::vector<ColMeta> &rec_cols, const Condition &cond, const RmRecord *rec) {
+    bool eval_cond(const std::vector<ColMeta> &rec_cols, const Condition &cond, const char *rec) {
         auto lhs_col = get_col(rec_cols, cond.lhs_col);
-        char *lhs = rec->data + lhs_col->offset;
-        char *rhs;
+        const char *lhs = rec + lhs_col->offset;
+        const char *rhs;
         ColType rhs_type;
         int rhs_len;
         
@@ -183,7 +191,7 @@ private:
         } else {
             auto rhs_col = get_col(rec_cols, cond.rhs_col);
             rhs_type = rhs_col->type;
-            rhs = rec->data + rhs_col->offset;
+            rhs = rec + rhs_col->offset;
             rhs_len = rhs_col->len;
         }
         
@@ -200,7 +208,7 @@ private:
         }
     }
 
-    bool eval_conds(const std::vector<ColMeta> &rec_cols, const std::vector<Condition> &conds, const RmRecord *rec) {
+    bool eval_conds(const std::vector<ColMeta> &rec_cols, const std::vector<Condition> &conds, const char *rec) {
         for (auto &cond : conds) {
             if (!eval_cond(rec_cols, cond, rec)) return false;
         }
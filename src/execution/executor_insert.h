@@ -20,7 +20,8 @@ class InsertExecutor : public AbstractExecutor {
         tab_ = sm_manager_->db_.get_table(tab_name);
         values_ = values;
         tab_name_ = tab_name;
-        if (values.size() != tab_.cols.size()) {
+        // 多行插入时values按行依次存放
+        if (values.empty() || values.size() % tab_.cols.size() != 0) {
             throw InvalidValueCountError();
         }
         fh_ = sm_manager_->fhs_.at(tab_name).get();
@@ -28,16 +29,25 @@ class InsertExecutor : public AbstractExecutor {
     };
 
     std::unique_ptr<RmRecord> Next() override {
-        RmRecord rec(fh_->get_file_hdr().record_size);
-        for (size_t i = 0; i < values_.size(); i++) {
-            auto &col = tab_.cols[i];
-            auto &val = values_[i];
-            if (col.type != val.type) {
-                throw IncompatibleTypeError(coltype2str(col.type), coltype2str(val.type));
+        const size_t num_rows = values_.size() / tab_.cols.size();
+        const int record_size = fh_->get_file_hdr().record_size;
+        if (num_rows > 1) {
+            // 多行插入使用批量插入，每个页面只固定一次、只产生一条写操作记录
+            std::vector<char> buf(num_rows * record_size);
+            for (size_t row = 0; row < num_rows; row++) {
+                build_record(row, buf.data() + row * record_size);
             }
-            val.init_raw(col.len);
-            memcpy(rec.data + col.offset, val.raw->data, col.len);
+            std::vector<Rid> rids;
+            fh_->insert_records(buf.data(), static_cast<int>(num_rows), &rids, context_);
+            for (size_t row = 0; row < num_rows; row++) {
+                insert_index_entries(buf.data() + row * record_size, rids[row]);
+            }
+            rid_ = rids.back();
+            return nullptr;
         }
+
+        RmRecord rec(record_size);
+        build_record(0, rec.data);
         
         // 1. 插入数据
         rid_ = fh_->insert_record(rec.data, context_);
@@ -50,19 +60,37 @@ class InsertExecutor : public AbstractExecutor {
         }
         
         // 3. 插入索引
+        insert_index_entries(rec.data, rid_);
+        return nullptr;
+    }
+    Rid &rid() override { return rid_; }
+
+   private:
+    // 将第row行的values写入记录缓冲区dst
+    void build_record(size_t row, char *dst) {
+        for (size_t i = 0; i < tab_.cols.size(); i++) {
+            auto &col = tab_.cols[i];
+            auto &val = values_[row * tab_.cols.size() + i];
+            if (col.type != val.type) {
+                throw IncompatibleTypeError(coltype2str(col.type), coltype2str(val.type));
+            }
+            val.init_raw(col.len);
+            memcpy(dst + col.offset, val.raw->data, col.len);
+        }
+    }
+
+    void insert_index_entries(const char *rec, const Rid &rid) {
         for(size_t i = 0; i < tab_.indexes.size(); ++i) {
             auto& index = tab_.indexes[i];
             auto ih = sm_manager_->ihs_.at(sm_manager_->get_ix_manager()->get_index_name(tab_name_, index.cols)).get();
             char* key = new char[index.col_tot_len];
             int offset = 0;
             for(size_t j = 0; j < index.col_num; ++j) {
-                memcpy(key + offset, rec.data + index.cols[j].offset, index.cols[j].len);
+                memcpy(key + offset, rec + index.cols[j].offset, index.cols[j].len);
                 offset += index.cols[j].len;
             }
-            ih->insert_entry(key, rid_, context_->txn_);
+            ih->insert_entry(key, rid, context_->txn_);
             delete[] key;
         }
-        return nullptr;
     }
-    Rid &rid() override { return rid_; }
-};
\ No newline at end of file
+};
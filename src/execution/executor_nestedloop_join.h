@@ -25,15 +25,17 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
     std::vector<Condition> fed_conds_;          // join条件
     bool isend;
 
-    // 当前左右元组缓存（避免重复调用Next）
-    std::unique_ptr<RmRecord> left_rec_;
-    std::unique_ptr<RmRecord> right_rec_;
+    // 当前左右元组的视图（避免重复调用Next）
+    RecordView left_rec_;
+    RecordView right_rec_;
+    std::unique_ptr<char[]> buf_;               // 连接结果的缓冲区，NextView返回的视图指向这里
 
    public:
     NestedLoopJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right, 
                             std::vector<Condition> conds) {
         left_ = std::move(left);
         right_ = std::move(right);
+        context_ = left_->context_;
         len_ = left_->tupleLen() + right_->tupleLen();
         cols_ = left_->cols();
         auto right_cols = right_->cols();
@@ -43,6 +45,7 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
         cols_.insert(cols_.end(), right_cols.begin(), right_cols.end());
         isend = false;
         fed_conds_ = std::move(conds);
+        buf_ = std::make_unique<char[]>(len_);
     }
 
     void beginTuple() override {
@@ -51,8 +54,8 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
     isend = left_->is_end();
 
     if (!isend && !right_->is_end()) {
-        left_rec_ = left_->Next();
-        right_rec_ = right_->Next();
+        left_rec_ = left_->NextView();
+        right_rec_ = right_->NextView();
     }
 }
 
@@ -63,7 +66,7 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
         // 移动右表
         right_->nextTuple();
         if (!right_->is_end()) {
-            right_rec_ = right_->Next();
+            right_rec_ = right_->NextView();
         } else {
             // 右表走完，移动左表，重置右表
             left_->nextTuple();
@@ -76,22 +79,28 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
                 isend = true;
                 return;
             }
-            right_rec_ = right_->Next();
-            left_rec_ = left_->Next();
+            right_rec_ = right_->NextView();
+            left_rec_ = left_->NextView();
         }
 
         // 检查条件
-        if (eval_conds(left_rec_.get(), right_rec_.get(), fed_conds_, cols_)) {
+        if (eval_conds(left_rec_.data(), right_rec_.data(), fed_conds_, cols_)) {
             break;
         }
     }
 }
 
    std::unique_ptr<RmRecord> Next() override {
-    auto rec = std::make_unique<RmRecord>(len_);
-    memcpy(rec->data, left_rec_->data, left_->tupleLen());
-    memcpy(rec->data + left_->tupleLen(), right_rec_->data, right_->tupleLen());
-    return rec;
+    return NextView().materialize(get_arena());
+}
+
+    /**
+     * @brief 连接结果写入buf_，视图在下一次调用前有效
+     */
+    RecordView NextView() override {
+    memcpy(buf_.get(), left_rec_.data(), left_->tupleLen());
+    memcpy(buf_.get() + left_->tupleLen(), right_rec_.data(), right_->tupleLen());
+    return RecordView(buf_.get(), static_cast<int>(len_));
 }
 
     Rid &rid() override { return _abstract_rid; }
@@ -105,7 +114,7 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
     const std::vector<ColMeta> &cols() const override { return cols_; }
 
     private:
-    bool eval_cond(const RmRecord *lhs_rec, const RmRecord *rhs_rec, const Condition &cond,
+    bool eval_cond(const char *lhs_rec, const char *rhs_rec, const Condition &cond,
                const std::vector<ColMeta> &rec_cols) {
     const auto &left_cols = left_->cols();
     const auto &right_cols = right_->cols();
@@ -113,8 +122,8 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
     auto lhs_col_it = get_col(left_cols, cond.lhs_col);
     auto rhs_col_it = get_col(right_cols, cond.rhs_col);
 
-    const char *lhs_val = lhs_rec->data + lhs_col_it->offset;
-    const char *rhs_val = rhs_rec->data + rhs_col_it->offset;
+    const char *lhs_val = lhs_rec + lhs_col_it->offset;
+    const char *rhs_val = rhs_rec + rhs_col_it->offset;
 
     int cmp = ix_compare(lhs_val, rhs_val, lhs_col_it->type, lhs_col_it->len);
 
@@ -129,7 +138,7 @@ class NestedLoopJoinExecutor : public AbstractExecutor {
     }
 }
 
-    bool eval_conds(const RmRecord *lhs_rec, const RmRecord *rhs_rec, const std::vector<Condition> &conds,
+    bool eval_conds(const char *lhs_rec, const char *rhs_rec, const std::vector<Condition> &conds,
                 const std::vector<ColMeta> &rec_cols) {
         if (conds.empty()) return true;  // ← 加这一行
         return std::all_of(conds.begin(), conds.end(),
@@ -21,10 +21,12 @@ class ProjectionExecutor : public AbstractExecutor {
     std::vector<ColMeta> cols_;                     // 需要投影的字段
     size_t len_;                                    // 字段总长度
     std::vector<size_t> sel_idxs_;                  
+    std::unique_ptr<char[]> buf_;                   // 投影结果的缓冲区，NextView返回的视图指向这里
 
    public:
     ProjectionExecutor(std::unique_ptr<AbstractExecutor> prev, const std::vector<TabCol> &sel_cols) {
         prev_ = std::move(prev);
+        context_ = prev_->context_;
 
         size_t curr_offset = 0;
         auto &prev_cols = prev_->cols();
@@ -37,6 +39,7 @@ class ProjectionExecutor : public AbstractExecutor {
             cols_.push_back(col);
         }
         len_ = curr_offset;
+        buf_ = std::make_unique<char[]>(len_);
     }
 
     void beginTuple() override {
@@ -48,23 +51,26 @@ class ProjectionExecutor : public AbstractExecutor {
 }
 
     std::unique_ptr<RmRecord> Next() override {
-    if (is_end()) return nullptr;
+    return NextView().materialize(get_arena());
+}
 
-    // 1. 从子节点拿整条原始记录
-    auto raw_rec = prev_->Next();
-    if (!raw_rec) return nullptr;
+    /**
+     * @brief 投影结果写入buf_，视图在下一次调用前有效，子节点的记录不被复制
+     */
+    RecordView NextView() override {
+    if (is_end()) return RecordView();
 
-    // 2. 创建投影后的记录缓冲区
-    auto proj_rec = std::make_unique<RmRecord>(len_);
-    char *dst = proj_rec->data;
+    // 1. 从子节点拿整条原始记录的视图
+    RecordView raw_rec = prev_->NextView();
+    if (!raw_rec.is_valid()) return RecordView();
 
-    // 3. 按 sel_idxs_ 把需要的列拷贝到新区
+    // 2. 按 sel_idxs_ 把需要的列拷贝到投影缓冲区
     for (size_t i = 0; i < sel_idxs_.size(); ++i) {
         const ColMeta &col = cols_[i];
-        const char *src = raw_rec->data + prev_->cols()[sel_idxs_[i]].offset;
-        std::memcpy(dst + col.offset, src, col.len);
+        const char *src = raw_rec.data() + prev_->cols()[sel_idxs_[i]].offset;
+        std::memcpy(buf_.get() + col.offset, src, col.len);
     }
-    return proj_rec;
+    return RecordView(buf_.get(), static_cast<int>(len_));
 }
 
     Rid &rid() override { return _abstract_rid; }
@@ -26,7 +26,9 @@ class SeqScanExecutor : public AbstractExecutor {
     std::vector<Condition> fed_conds_;  // 同conds_，两个字段相同
 
     Rid rid_;
-    std::unique_ptr<RecScan> scan_;     // table_iterator
+    std::unique_ptr<RmBatchScan> scan_; // table_iterator，按页面扫描
+    RmPageBatch batch_;                 // 当前扫描的页面，rid_指向其中第batch_idx_条记录
+    size_t batch_idx_ = 0;
 
     SmManager *sm_manager_;
 
@@ -58,32 +60,18 @@ class SeqScanExecutor : public AbstractExecutor {
         }
         // ==============================
 
-        scan_ = std::make_unique<RmScan>(fh_);
-        while (!scan_->is_end()) {
-            rid_ = scan_->rid();
-            auto rec = fh_->get_record(rid_, context_);
-            if (eval_conds(rec.get(), fed_conds_, cols_)) {
-                return;
-            }
-            scan_->next();
-        }
-        rid_ = Rid{-1, -1};
+        scan_ = std::make_unique<RmBatchScan>(fh_);
+        batch_.release();
+        batch_idx_ = 0;
+        seek();
     }
 
     /**
      * @brief 从当前scan_指向的记录开始迭代扫描,直到扫描到第一个满足谓词条件的元组停止,并赋值给rid_
      */
     void nextTuple() override {
-        scan_->next();
-        while (!scan_->is_end()) {
-            rid_ = scan_->rid();
-            auto rec = fh_->get_record(rid_, context_);
-            if (eval_conds(rec.get(), fed_conds_, cols_)) {
-                return;
-            }
-            scan_->next();
-        }
-        rid_ = Rid{-1, -1};
+        batch_idx_++;
+        seek();
     }
 
     /**
@@ -91,7 +79,15 @@ class SeqScanExecutor : public AbstractExecutor {
      */
     std::unique_ptr<RmRecord> Next() override {
         if (is_end()) return nullptr;
-        return fh_->get_record(rid_, context_);
+        return batch_.view(batch_idx_).materialize(get_arena());
+    }
+
+    /**
+     * @brief 返回下一个满足扫描条件的记录的视图，视图与扫描共享页面的pin
+     */
+    RecordView NextView() override {
+        if (is_end()) return RecordView();
+        return batch_.view(batch_idx_);
     }
 
     Rid &rid() override { return rid_; }
@@ -107,7 +103,30 @@ class SeqScanExecutor : public AbstractExecutor {
     const std::vector<ColMeta> &cols() const override { return cols_; }
 
 private:
-    bool eval_cond(const RmRecord *rec, const Condition &cond,
+    /**
+     * @brief 从当前页面的第batch_idx_条记录开始找第一个满足谓词条件的记录，当前页面找完后按页取下一个页面。
+     * 记录直接在缓冲池的帧中求值，不复制；页面锁只在求值期间持有，不跨越nextTuple
+     */
+    void seek() {
+        while (true) {
+            {
+                ScopedReadLatch latch(batch_.page());
+                for (; batch_idx_ < batch_.size(); batch_idx_++) {
+                    if (eval_conds(batch_.record(batch_idx_), fed_conds_, cols_)) {
+                        rid_ = batch_.rid(batch_idx_);
+                        return;
+                    }
+                }
+            }
+            if (!scan_->next_batch(&batch_)) {
+                break;
+            }
+            batch_idx_ = 0;
+        }
+        rid_ = Rid{-1, -1};
+    }
+
+    bool eval_cond(const char *rec, const Condition &cond,
                    const std::vector<ColMeta> &rec_cols) {
         char *lhs_val = nullptr;
         char *rhs_val = nullptr;
@@ -117,7 +136,7 @@ private:
         auto lhs_it = get_col(rec_cols, cond.lhs_col);
         lhs_type = lhs_it->type;
         lhs_len  = lhs_it->len;
-        lhs_val  = const_cast<char *>(rec->data + lhs_it->offset);
+        lhs_val  = const_cast<char *>(rec + lhs_it->offset);
 
         if (cond.is_rhs_val) {
             rhs_type = cond.rhs_val.type;
@@ -127,7 +146,7 @@ private:
             auto rhs_it = get_col(rec_cols, cond.rhs_col);
             rhs_type = rhs_it->type;
             rhs_len  = rhs_it->len;
-            rhs_val  = const_cast<char *>(rec->data + rhs_it->offset);
+            rhs_val  = const_cast<char *>(rec + rhs_it->offset);
         }
 
         if (lhs_type != rhs_type) return false;
@@ -144,7 +163,7 @@ private:
         }
     }
 
-    bool eval_conds(const RmRecord *rec, const std::vector<Condition> &conds, const std::vector<ColMeta> &rec_cols) {
+    bool eval_conds(const char *rec, const std::vector<Condition> &conds, const std::vector<ColMeta> &rec_cols) {
         return std::all_of(conds.begin(), conds.end(),
             [&](const Condition &cond) { return eval_cond(rec, cond, rec_cols); }
         );
@@ -547,11 +547,13 @@ bool IxIndexHandle::adjust_root(IxNodeHandle *old_root_node) {
         update_root_page_no(child_page_no);
         buffer_pool_manager_->unpin_page(child->get_page_id(), true);
         release_node_handle(*old_root_node);
+        buffer_pool_manager_->unpin_page(old_root_node->get_page_id(), true);
         return true;
     }
     if (old_root_node->is_leaf_page() && old_root_node->get_size() == 0) {
-        release_node_handle(*old_root_node);
+        // 空的根叶子仍挂在叶子链表上（first_leaf_/last_leaf_指向它），不能放入空闲链表复用
         update_root_page_no(IX_NO_PAGE);
+        buffer_pool_manager_->unpin_page(old_root_node->get_page_id(), true);
         return true;
     }
     return false;
@@ -686,7 +688,7 @@ bool IxIndexHandle::coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node,
     
     // 释放right节点
     release_node_handle(*right);
-    buffer_pool_manager_->unpin_page(right->get_page_id(), false);
+    buffer_pool_manager_->unpin_page(right->get_page_id(), true);
     
     // 返回父节点是否需要继续合并或重分配
     return (*parent)->get_size() < (*parent)->get_min_size();
@@ -702,12 +704,12 @@ bool IxIndexHandle::coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node,
  * @note iid和rid存的不是一个东西，rid是上层传过来的记录位置，iid是索引内部生成的索引槽位置
  */
 Rid IxIndexHandle::get_rid(const Iid &iid) const {
-    IxNodeHandle *node = fetch_node(iid.page_no);
-    if (iid.slot_no >= node->get_size()) {
+    ReadPageGuard guard = fetch_node_read(iid.page_no);
+    IxNodeHandle node(file_hdr_, guard.get_page());
+    if (iid.slot_no >= node.get_size()) {
         throw IndexEntryNotFoundError();
     }
-    buffer_pool_manager_->unpin_page(node->get_page_id(), false);  // unpin it!
-    return *node->get_rid(iid.slot_no);
+    return *node.get_rid(iid.slot_no);
 }
 
 /**
@@ -794,6 +796,20 @@ IxNodeHandle *IxIndexHandle::fetch_node(int page_no) const {
     return node;
 }
 
+/**
+ * @brief 获取结点所在的页面并加读锁，句柄析构时自动unpin
+ *
+ * @param page_no 结点的页面编号
+ * @return ReadPageGuard 页面的读锁句柄
+ */
+ReadPageGuard IxIndexHandle::fetch_node_read(int page_no) const {
+    ReadPageGuard guard = buffer_pool_manager_->fetch_page_read(PageId{fd_, page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("IxIndexHandle::fetch_node_read: failed to fetch page");
+    }
+    return guard;
+}
+
 /**
  * @brief 创建一个新结点
  *
@@ -801,11 +817,22 @@ IxNodeHandle *IxIndexHandle::fetch_node(int page_no) const {
  * @note pin the page, remember to unpin it outside!
  * 注意：对于Index的处理是，删除某个页面后，认为该被删除的页面是free_page
  * 而first_free_page实际上就是最新被删除的页面，初始为IX_NO_PAGE
- * 在最开始插入时，一直是create node，那么first_page_no一直没变，一直是IX_NO_PAGE
+ * 空闲页面通过page_hdr->next_free_page_no串成链表，创建结点时优先从链表头取出复用，链表为空时才扩展文件
  * 与Record的处理不同，Record将未插入满的记录页认为是free_page
  */
 IxNodeHandle *IxIndexHandle::create_node() {
     IxNodeHandle *node;
+    if (file_hdr_->first_free_page_no_ != IX_NO_PAGE) {
+        Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, file_hdr_->first_free_page_no_});
+        if (page == nullptr) throw PageNotExistError("IxIndexHandle", file_hdr_->first_free_page_no_);
+        auto page_hdr = reinterpret_cast<IxPageHdr *>(page->get_data());
+        file_hdr_->first_free_page_no_ = page_hdr->next_free_page_no;
+        // 与new_page保持一致，返回内容清零的页面
+        memset(page->get_data(), 0, PAGE_SIZE);
+        page_hdr->next_free_page_no = IX_NO_PAGE;
+        node = new IxNodeHandle(file_hdr_, page);
+        return node;
+    }
     file_hdr_->num_pages_++;
 
     PageId new_page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
@@ -857,12 +884,16 @@ void IxIndexHandle::erase_leaf(IxNodeHandle *leaf) {
 }
 
 /**
- * @brief 删除node时，更新file_hdr_.num_pages
+ * @brief 删除node时，将其页面挂到空闲链表头部，供之后的create_node复用
+ * file_hdr_.num_pages记录的是文件中已分配的页面数，打开文件时据此设置分配起点，因此这里不能减少
  *
  * @param node
+ * @note 调用者仍持有node的pin，需要以dirty方式unpin
  */
 void IxIndexHandle::release_node_handle(IxNodeHandle &node) {
-    file_hdr_->num_pages_--;
+    node.page_hdr->next_free_page_no = file_hdr_->first_free_page_no_;
+    node.page_hdr->num_key = 0;
+    file_hdr_->first_free_page_no_ = node.get_page_no();
 }
 
 /**
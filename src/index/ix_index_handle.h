@@ -205,6 +205,8 @@ class IxIndexHandle {
 
     Iid leaf_begin() const;
 
+    int get_fd() const { return fd_; }
+
    private:
     // 辅助函数
     void update_root_page_no(page_id_t root) { file_hdr_->root_page_ = root; }
@@ -214,6 +216,8 @@ class IxIndexHandle {
     // for get/create node
     IxNodeHandle *fetch_node(int page_no) const;
 
+    ReadPageGuard fetch_node_read(int page_no) const;
+
     IxNodeHandle *create_node();
 
     // for maintain data structure
@@ -379,8 +379,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 47
-#define YY_END_OF_BUFFER 48
+#define YY_NUM_RULES 49
+#define YY_END_OF_BUFFER 50
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -388,25 +388,25 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[154] =
+static const flex_int16_t yy_accept[159] =
     {   0,
-        0,    0,    0,    0,   48,   46,    6,    7,    7,   46,
-       41,   46,   46,   46,   43,   41,   41,   42,   42,   42,
-       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
-       42,   42,   42,   42,    3,    4,    6,    7,    0,   45,
-       43,    5,    1,   44,   39,   40,   38,   42,   42,   42,
-       42,   42,   36,   42,   42,   42,   42,   42,   42,   42,
-       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
-       42,   42,    2,    5,   44,   42,   31,   37,   42,   42,
-       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
-       42,   27,   42,   42,   42,   42,   25,   42,   42,   42,
-
-       42,   42,   42,   42,   28,   42,   42,   42,   17,   16,
-       33,   42,   22,   34,   42,   42,   19,   32,   42,   42,
-       42,    8,   42,   42,   42,   42,   11,    9,   42,   42,
-       42,   29,   30,   42,   35,   42,   42,   15,   42,   42,
-       23,   10,   14,   21,   18,   42,   26,   13,   24,   20,
-       42,   12,    0
+        0,    0,    0,    0,   50,   48,    6,    7,    7,   48,
+       43,   48,   48,   48,   45,   43,   43,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,    3,    4,    6,    7,    0,   47,
+       45,    5,    1,   46,   41,   42,   40,   44,   44,   44,
+       44,   44,   36,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   38,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,    2,    5,   46,   44,   31,   37,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   27,   44,   44,   44,   44,   25,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   28,   44,   44,
+       44,   17,   16,   33,   44,   22,   34,   44,   44,   19,
+       32,   44,   44,   44,    8,   44,   44,   44,   44,   44,
+       11,    9,   44,   44,   44,   29,   30,   44,   35,   44,
+       44,   39,   15,   44,   44,   23,   10,   14,   21,   18,
+       44,   26,   13,   24,   20,   44,   12,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -452,49 +452,51 @@ static const YY_CHAR yy_meta[69] =
         3,    3,    3,    3,    3,    3,    3,    3
     } ;
 
-static const flex_int16_t yy_base[158] =
+static const flex_int16_t yy_base[163] =
     {   0,
-        0,    0,  281,  280,  287,  306,  284,  306,  279,  274,
-      306,  261,   58,  265,   59,   57,  238,   50,   54,   50,
-       55,   38,   54,    0,   58,   56,   59,   58,   62,   75,
-       80,   66,   87,   87,  306,  176,  139,  306,   88,  306,
-      116,    0,  306,   75,  306,  306,  306,    0,   84,   98,
-      102,  104,    0,  112,  102,  111,  105,  103,  110,  105,
-      107,  114,  131,  118,  125,  118,  120,  118,  132,  132,
-      126,  142,  306,    0,   71,  136,    0,    0,  148,  145,
-      153,  166,  163,  166,  154,  152,  173,  164,  162,  175,
-      176,  167,  170,  180,  174,  182,    0,  166,  178,  190,
-
-      177,  181,  181,  188,    0,  196,  189,  195,    0,    0,
-        0,  198,    0,    0,  195,  202,    0,    0,  203,  220,
-      222,    0,  222,  209,  225,  227,    0,    0,  215,  228,
-      231,    0,    0,  218,    0,  238,  221,  223,  242,  230,
-        0,    0,    0,    0,    0,  247,    0,    0,    0,    0,
-      241,    0,  306,  296,  299,   76,  302
+        0,    0,  288,  287,  292,  324,  289,  324,  287,  284,
+      324,  267,   58,  230,   59,   57,  137,   50,   54,   50,
+       55,   38,   54,    0,   58,   60,   55,   59,   65,  100,
+       80,   67,   87,   87,  324,  124,   98,  324,   89,  324,
+      116,    0,  324,   75,  324,  324,  324,    0,   84,   99,
+      108,  106,    0,  114,  103,  112,  111,  103,  113,  109,
+      111,  115,  142,    0,  119,  128,  121,  144,  125,  146,
+      149,  153,  153,  162,  324,    0,   71,  117,    0,    0,
+      159,  120,  156,  169,  166,  171,  159,  158,  175,  166,
+      164,  176,  179,  170,  174,  185,  180,  193,    0,  181,
+
+      188,  187,  208,  191,  195,  195,  203,    0,  210,  201,
+      202,    0,    0,    0,  203,    0,    0,  202,  209,    0,
+        0,  210,  228,  228,    0,  215,  227,  216,  234,  236,
+        0,    0,  224,  237,  244,    0,    0,  234,    0,  249,
+      235,    0,  241,  257,  245,    0,    0,    0,    0,    0,
+      263,    0,    0,    0,    0,  259,    0,  324,  314,  317,
+       76,  320
     } ;
 
-static const flex_int16_t yy_def[158] =
+static const flex_int16_t yy_def[163] =
     {   0,
-      153,    1,  154,  154,  153,  153,  153,  153,  153,  155,
-      153,  153,  153,  153,  153,  153,  153,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  153,  153,  153,  153,  155,  153,
-      153,  157,  153,  153,  153,  153,  153,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  153,  157,  153,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
-      156,  156,    0,  153,  153,  153,  153
+      158,    1,  159,  159,  158,  158,  158,  158,  158,  160,
+      158,  158,  158,  158,  158,  158,  158,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  158,  158,  158,  158,  160,  158,
+      158,  162,  158,  158,  158,  158,  158,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  158,  162,  158,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,    0,  158,  158,
+      158,  158
     } ;
 
-static const flex_int16_t yy_nxt[375] =
+static const flex_int16_t yy_nxt[393] =
     {   0,
         6,    7,    8,    9,   10,   11,   11,   11,   12,   11,
        13,   11,   14,   15,   11,   16,   11,   17,   18,   19,
@@ -504,42 +506,45 @@ static const flex_int16_t yy_nxt[375] =
        24,   25,   26,   27,   24,   24,   24,   24,   28,   24,
        29,   30,   31,   32,   33,   34,   24,   24,   42,   49,
        44,   41,   41,   45,   46,   54,   52,   57,   48,   59,
-       62,   50,   55,   60,   75,   56,   51,   63,   75,   61,
-       58,   64,   40,   65,   66,   49,   53,   67,   69,   70,
-
-       68,   54,   52,   57,   59,   71,   62,   50,   55,   60,
-       56,   51,   72,   63,   61,   58,   76,   64,   65,   77,
-       66,   53,   78,   67,   69,   70,   68,   44,   79,   41,
-       80,   71,   81,   82,   83,   85,   86,   87,   72,   88,
-       37,   84,   76,   89,   93,   77,   94,   95,   78,   96,
-       98,   99,   90,  100,   79,  101,   80,   97,   81,   82,
-       83,   85,   86,   87,  102,   88,   84,   91,   92,   89,
-       93,  103,   94,   95,  104,   96,   98,   99,   90,  100,
-      105,  101,   97,  106,  107,  108,  109,  110,   73,  111,
-      102,  112,   91,   92,  113,  114,  103,  115,  116,  117,
-
-      104,  118,  119,  120,  121,  105,  122,  123,  124,  106,
-      107,  108,  109,  110,  111,  125,  126,  112,  127,  128,
-      113,  114,  129,  115,  116,  117,  130,  118,  119,  120,
-      121,  122,  131,  123,  124,  132,  133,  134,  135,  136,
-      125,  126,  137,  127,  138,  128,  139,  140,  129,  141,
-      143,  130,  142,  144,   47,  145,  146,  131,  147,  148,
-      132,  133,  134,  135,  149,  136,  150,  151,  137,  152,
-      138,  139,   43,  140,   41,  141,  143,  142,   40,  144,
-      145,   38,  146,  147,  148,   37,  153,   36,   36,  153,
-      149,  150,  153,  151,  153,  152,   35,   35,   35,   39,
-
-       39,   39,   74,  153,   74,    5,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153
+       62,   50,   55,   60,   77,   56,   51,   65,   77,   61,
+       58,   63,   64,   40,   66,   49,   53,   67,   71,   37,
+
+       72,   54,   52,   57,   59,   73,   62,   50,   55,   60,
+       56,   51,   74,   65,   61,   58,   78,   63,   64,   66,
+       79,   53,   68,   67,   71,   69,   72,   44,   80,   41,
+       81,   73,   82,   83,   84,   87,   75,   70,   74,   88,
+       85,   89,   78,   90,   91,   95,   79,   86,   68,   96,
+       97,   69,  106,   47,   80,  108,   81,  100,   82,   83,
+       84,   87,   70,   92,  101,   88,   85,   89,  102,   90,
+       91,   95,   86,   98,  103,   96,   97,  106,   93,   94,
+      108,   99,  104,  100,  105,  107,  109,  110,  111,   92,
+      101,  112,  113,  115,  102,  114,  116,  117,  118,   98,
+
+      103,  119,  120,   93,   94,  121,   99,  122,  104,  123,
+      105,  107,  109,  110,  111,  124,  127,  112,  113,  115,
+      114,  125,  116,  117,  118,  126,  128,  119,  120,  129,
+      130,  121,  131,  122,  132,  123,  133,   43,  134,  135,
+      136,  124,  127,  137,  138,  139,  125,  140,  141,  143,
+      126,  142,  128,  144,  129,  130,  145,  131,  146,  148,
+      132,  147,  133,  134,  135,  136,  149,  151,  137,  138,
+      139,  150,  152,  140,  141,  143,  142,  153,  144,  154,
+       41,  155,  145,  156,  146,  148,  147,  157,   40,   38,
+       37,  158,  149,  151,   36,   36,  150,  152,  158,  158,
+
+      158,  158,  153,  158,  158,  154,  155,  158,  158,  156,
+      158,  158,  158,  157,   35,   35,   35,   39,   39,   39,
+       76,  158,   76,    5,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158
+
     } ;
 
-static const flex_int16_t yy_chk[375] =
+static const flex_int16_t yy_chk[393] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -548,40 +553,43 @@ static const flex_int16_t yy_chk[375] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,   13,   18,
-       15,   13,   15,   16,   16,   20,   19,   21,  156,   22,
-       25,   18,   20,   23,   75,   20,   18,   26,   44,   23,
-       21,   27,   39,   28,   29,   18,   19,   30,   31,   32,
-
-       30,   20,   19,   21,   22,   33,   25,   18,   20,   23,
-       20,   18,   34,   26,   23,   21,   49,   27,   28,   50,
-       29,   19,   51,   30,   31,   32,   30,   41,   52,   41,
-       54,   33,   55,   56,   57,   58,   59,   60,   34,   61,
-       37,   57,   49,   62,   64,   50,   65,   66,   51,   67,
-       68,   69,   63,   70,   52,   71,   54,   67,   55,   56,
-       57,   58,   59,   60,   72,   61,   57,   63,   63,   62,
-       64,   76,   65,   66,   79,   67,   68,   69,   63,   70,
-       80,   71,   67,   81,   82,   83,   84,   85,   36,   86,
-       72,   87,   63,   63,   88,   89,   76,   90,   91,   92,
-
-       79,   93,   94,   95,   96,   80,   98,   99,  100,   81,
-       82,   83,   84,   85,   86,  101,  102,   87,  103,  104,
-       88,   89,  106,   90,   91,   92,  107,   93,   94,   95,
-       96,   98,  108,   99,  100,  112,  115,  116,  119,  120,
-      101,  102,  121,  103,  123,  104,  124,  125,  106,  126,
-      130,  107,  129,  131,   17,  134,  136,  108,  137,  138,
-      112,  115,  116,  119,  139,  120,  140,  146,  121,  151,
-      123,  124,   14,  125,   12,  126,  130,  129,   10,  131,
-      134,    9,  136,  137,  138,    7,    5,    4,    3,    0,
-      139,  140,    0,  146,    0,  151,  154,  154,  154,  155,
-
-      155,  155,  157,    0,  157,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
-      153,  153,  153,  153
+       15,   13,   15,   16,   16,   20,   19,   21,  161,   22,
+       25,   18,   20,   23,   77,   20,   18,   27,   44,   23,
+       21,   26,   26,   39,   28,   18,   19,   29,   31,   37,
+
+       32,   20,   19,   21,   22,   33,   25,   18,   20,   23,
+       20,   18,   34,   27,   23,   21,   49,   26,   26,   28,
+       50,   19,   30,   29,   31,   30,   32,   41,   51,   41,
+       52,   33,   54,   55,   56,   58,   36,   30,   34,   59,
+       57,   60,   49,   61,   62,   65,   50,   57,   30,   66,
+       67,   30,   78,   17,   51,   82,   52,   69,   54,   55,
+       56,   58,   30,   63,   70,   59,   57,   60,   71,   61,
+       62,   65,   57,   68,   72,   66,   67,   78,   63,   63,
+       82,   68,   73,   69,   74,   81,   83,   84,   85,   63,
+       70,   86,   87,   89,   71,   88,   90,   91,   92,   68,
+
+       72,   93,   94,   63,   63,   95,   68,   96,   73,   97,
+       74,   81,   83,   84,   85,   98,  102,   86,   87,   89,
+       88,  100,   90,   91,   92,  101,  103,   93,   94,  104,
+      105,   95,  106,   96,  107,   97,  109,   14,  110,  111,
+      115,   98,  102,  118,  119,  122,  100,  123,  124,  127,
+      101,  126,  103,  128,  104,  105,  129,  106,  130,  134,
+      107,  133,  109,  110,  111,  115,  135,  140,  118,  119,
+      122,  138,  141,  123,  124,  127,  126,  143,  128,  144,
+       12,  145,  129,  151,  130,  134,  133,  156,   10,    9,
+        7,    5,  135,  140,    4,    3,  138,  141,    0,    0,
+
+        0,    0,  143,    0,    0,  144,  145,    0,    0,  151,
+        0,    0,    0,  156,  159,  159,  159,  160,  160,  160,
+      162,    0,  162,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158
+
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -623,9 +631,9 @@ char *yytext;
         } \
     }
 
-#line 627 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
+#line 635 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
 
-#line 629 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
+#line 637 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
 
 #define INITIAL 0
 #define STATE_COMMENT 1
@@ -863,7 +871,7 @@ YY_DECL
 
 #line 48 "lex.l"
     /* block comment */
-#line 867 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
+#line 875 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -890,13 +898,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 154 )
+				if ( yy_current_state >= 159 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 306 );
+		while ( yy_base[yy_current_state] != 324 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1110,57 +1118,67 @@ YY_RULE_SETUP
 #line 88 "lex.l"
 { return ASC; }
 	YY_BREAK
-/* operators */
 case 38:
 YY_RULE_SETUP
-#line 90 "lex.l"
-{ return GEQ; }
+#line 89 "lex.l"
+{ return IO; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 91 "lex.l"
-{ return LEQ; }
+#line 90 "lex.l"
+{ return STATS; }
 	YY_BREAK
+/* operators */
 case 40:
 YY_RULE_SETUP
 #line 92 "lex.l"
-{ return NEQ; }
+{ return GEQ; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 93 "lex.l"
-{ return yytext[0]; }
+{ return LEQ; }
 	YY_BREAK
-/* id */
 case 42:
 YY_RULE_SETUP
+#line 94 "lex.l"
+{ return NEQ; }
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
 #line 95 "lex.l"
+{ return yytext[0]; }
+	YY_BREAK
+/* id */
+case 44:
+YY_RULE_SETUP
+#line 97 "lex.l"
 {
     yylval->sv_str = yytext;
     return IDENTIFIER;
 }
 	YY_BREAK
 /* literals */
-case 43:
+case 45:
 YY_RULE_SETUP
-#line 100 "lex.l"
+#line 102 "lex.l"
 {
     yylval->sv_int = atoi(yytext);
     return VALUE_INT;
 }
 	YY_BREAK
-case 44:
+case 46:
 YY_RULE_SETUP
-#line 104 "lex.l"
+#line 106 "lex.l"
 {
     yylval->sv_float = atof(yytext);
     return VALUE_FLOAT;
 }
 	YY_BREAK
-case 45:
-/* rule 45 can match eol */
+case 47:
+/* rule 47 can match eol */
 YY_RULE_SETUP
-#line 108 "lex.l"
+#line 110 "lex.l"
 {
     yylval->sv_str = std::string(yytext + 1, strlen(yytext) - 2);
     return VALUE_STRING;
@@ -1169,21 +1187,21 @@ YY_RULE_SETUP
 /* EOF */
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(STATE_COMMENT):
-#line 113 "lex.l"
+#line 115 "lex.l"
 { return T_EOF; }
 	YY_BREAK
 /* unexpected char */
-case 46:
+case 48:
 YY_RULE_SETUP
-#line 115 "lex.l"
+#line 117 "lex.l"
 { std::cerr << "Lexer Error: unexpected character " << yytext[0] << std::endl; }
 	YY_BREAK
-case 47:
+case 49:
 YY_RULE_SETUP
-#line 116 "lex.l"
+#line 118 "lex.l"
 ECHO;
 	YY_BREAK
-#line 1187 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
+#line 1205 "/home/rucbase/rucbase-lab/src/parser/lex.yy.cpp"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -1478,7 +1496,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 154 )
+			if ( yy_current_state >= 159 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1506,7 +1524,7 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 154 )
+		if ( yy_current_state >= 159 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2149,6 +2167,6 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 116 "lex.l"
+#line 118 "lex.l"
 
 
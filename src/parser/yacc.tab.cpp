@@ -115,81 +115,84 @@ enum yysymbol_kind_t
   YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
   YYSYMBOL_SHOW = 3,                       /* SHOW  */
   YYSYMBOL_TABLES = 4,                     /* TABLES  */
-  YYSYMBOL_CREATE = 5,                     /* CREATE  */
-  YYSYMBOL_TABLE = 6,                      /* TABLE  */
-  YYSYMBOL_DROP = 7,                       /* DROP  */
-  YYSYMBOL_DESC = 8,                       /* DESC  */
-  YYSYMBOL_INSERT = 9,                     /* INSERT  */
-  YYSYMBOL_INTO = 10,                      /* INTO  */
-  YYSYMBOL_VALUES = 11,                    /* VALUES  */
-  YYSYMBOL_DELETE = 12,                    /* DELETE  */
-  YYSYMBOL_FROM = 13,                      /* FROM  */
-  YYSYMBOL_ASC = 14,                       /* ASC  */
-  YYSYMBOL_ORDER = 15,                     /* ORDER  */
-  YYSYMBOL_BY = 16,                        /* BY  */
-  YYSYMBOL_WHERE = 17,                     /* WHERE  */
-  YYSYMBOL_UPDATE = 18,                    /* UPDATE  */
-  YYSYMBOL_SET = 19,                       /* SET  */
-  YYSYMBOL_SELECT = 20,                    /* SELECT  */
-  YYSYMBOL_INT = 21,                       /* INT  */
-  YYSYMBOL_CHAR = 22,                      /* CHAR  */
-  YYSYMBOL_FLOAT = 23,                     /* FLOAT  */
-  YYSYMBOL_INDEX = 24,                     /* INDEX  */
-  YYSYMBOL_AND = 25,                       /* AND  */
-  YYSYMBOL_JOIN = 26,                      /* JOIN  */
-  YYSYMBOL_EXIT = 27,                      /* EXIT  */
-  YYSYMBOL_HELP = 28,                      /* HELP  */
-  YYSYMBOL_TXN_BEGIN = 29,                 /* TXN_BEGIN  */
-  YYSYMBOL_TXN_COMMIT = 30,                /* TXN_COMMIT  */
-  YYSYMBOL_TXN_ABORT = 31,                 /* TXN_ABORT  */
-  YYSYMBOL_TXN_ROLLBACK = 32,              /* TXN_ROLLBACK  */
-  YYSYMBOL_ORDER_BY = 33,                  /* ORDER_BY  */
-  YYSYMBOL_LEQ = 34,                       /* LEQ  */
-  YYSYMBOL_NEQ = 35,                       /* NEQ  */
-  YYSYMBOL_GEQ = 36,                       /* GEQ  */
-  YYSYMBOL_T_EOF = 37,                     /* T_EOF  */
-  YYSYMBOL_IDENTIFIER = 38,                /* IDENTIFIER  */
-  YYSYMBOL_VALUE_STRING = 39,              /* VALUE_STRING  */
-  YYSYMBOL_VALUE_INT = 40,                 /* VALUE_INT  */
-  YYSYMBOL_VALUE_FLOAT = 41,               /* VALUE_FLOAT  */
-  YYSYMBOL_42_ = 42,                       /* ';'  */
-  YYSYMBOL_43_ = 43,                       /* '('  */
-  YYSYMBOL_44_ = 44,                       /* ')'  */
-  YYSYMBOL_45_ = 45,                       /* ','  */
-  YYSYMBOL_46_ = 46,                       /* '.'  */
-  YYSYMBOL_47_ = 47,                       /* '='  */
-  YYSYMBOL_48_ = 48,                       /* '<'  */
-  YYSYMBOL_49_ = 49,                       /* '>'  */
-  YYSYMBOL_50_ = 50,                       /* '*'  */
-  YYSYMBOL_YYACCEPT = 51,                  /* $accept  */
-  YYSYMBOL_start = 52,                     /* start  */
-  YYSYMBOL_stmt = 53,                      /* stmt  */
-  YYSYMBOL_txnStmt = 54,                   /* txnStmt  */
-  YYSYMBOL_dbStmt = 55,                    /* dbStmt  */
-  YYSYMBOL_ddl = 56,                       /* ddl  */
-  YYSYMBOL_dml = 57,                       /* dml  */
-  YYSYMBOL_fieldList = 58,                 /* fieldList  */
-  YYSYMBOL_colNameList = 59,               /* colNameList  */
-  YYSYMBOL_field = 60,                     /* field  */
-  YYSYMBOL_type = 61,                      /* type  */
-  YYSYMBOL_valueList = 62,                 /* valueList  */
-  YYSYMBOL_value = 63,                     /* value  */
-  YYSYMBOL_condition = 64,                 /* condition  */
-  YYSYMBOL_optWhereClause = 65,            /* optWhereClause  */
-  YYSYMBOL_whereClause = 66,               /* whereClause  */
-  YYSYMBOL_col = 67,                       /* col  */
-  YYSYMBOL_colList = 68,                   /* colList  */
-  YYSYMBOL_op = 69,                        /* op  */
-  YYSYMBOL_expr = 70,                      /* expr  */
-  YYSYMBOL_setClauses = 71,                /* setClauses  */
-  YYSYMBOL_setClause = 72,                 /* setClause  */
-  YYSYMBOL_selector = 73,                  /* selector  */
-  YYSYMBOL_tableList = 74,                 /* tableList  */
-  YYSYMBOL_opt_order_clause = 75,          /* opt_order_clause  */
-  YYSYMBOL_order_clause = 76,              /* order_clause  */
-  YYSYMBOL_opt_asc_desc = 77,              /* opt_asc_desc  */
-  YYSYMBOL_tbName = 78,                    /* tbName  */
-  YYSYMBOL_colName = 79                    /* colName  */
+  YYSYMBOL_IO = 5,                         /* IO  */
+  YYSYMBOL_STATS = 6,                      /* STATS  */
+  YYSYMBOL_CREATE = 7,                     /* CREATE  */
+  YYSYMBOL_TABLE = 8,                      /* TABLE  */
+  YYSYMBOL_DROP = 9,                       /* DROP  */
+  YYSYMBOL_DESC = 10,                      /* DESC  */
+  YYSYMBOL_INSERT = 11,                    /* INSERT  */
+  YYSYMBOL_INTO = 12,                      /* INTO  */
+  YYSYMBOL_VALUES = 13,                    /* VALUES  */
+  YYSYMBOL_DELETE = 14,                    /* DELETE  */
+  YYSYMBOL_FROM = 15,                      /* FROM  */
+  YYSYMBOL_ASC = 16,                       /* ASC  */
+  YYSYMBOL_ORDER = 17,                     /* ORDER  */
+  YYSYMBOL_BY = 18,                        /* BY  */
+  YYSYMBOL_WHERE = 19,                     /* WHERE  */
+  YYSYMBOL_UPDATE = 20,                    /* UPDATE  */
+  YYSYMBOL_SET = 21,                       /* SET  */
+  YYSYMBOL_SELECT = 22,                    /* SELECT  */
+  YYSYMBOL_INT = 23,                       /* INT  */
+  YYSYMBOL_CHAR = 24,                      /* CHAR  */
+  YYSYMBOL_FLOAT = 25,                     /* FLOAT  */
+  YYSYMBOL_INDEX = 26,                     /* INDEX  */
+  YYSYMBOL_AND = 27,                       /* AND  */
+  YYSYMBOL_JOIN = 28,                      /* JOIN  */
+  YYSYMBOL_EXIT = 29,                      /* EXIT  */
+  YYSYMBOL_HELP = 30,                      /* HELP  */
+  YYSYMBOL_TXN_BEGIN = 31,                 /* TXN_BEGIN  */
+  YYSYMBOL_TXN_COMMIT = 32,                /* TXN_COMMIT  */
+  YYSYMBOL_TXN_ABORT = 33,                 /* TXN_ABORT  */
+  YYSYMBOL_TXN_ROLLBACK = 34,              /* TXN_ROLLBACK  */
+  YYSYMBOL_ORDER_BY = 35,                  /* ORDER_BY  */
+  YYSYMBOL_LEQ = 36,                       /* LEQ  */
+  YYSYMBOL_NEQ = 37,                       /* NEQ  */
+  YYSYMBOL_GEQ = 38,                       /* GEQ  */
+  YYSYMBOL_T_EOF = 39,                     /* T_EOF  */
+  YYSYMBOL_IDENTIFIER = 40,                /* IDENTIFIER  */
+  YYSYMBOL_VALUE_STRING = 41,              /* VALUE_STRING  */
+  YYSYMBOL_VALUE_INT = 42,                 /* VALUE_INT  */
+  YYSYMBOL_VALUE_FLOAT = 43,               /* VALUE_FLOAT  */
+  YYSYMBOL_44_ = 44,                       /* ';'  */
+  YYSYMBOL_45_ = 45,                       /* '('  */
+  YYSYMBOL_46_ = 46,                       /* ')'  */
+  YYSYMBOL_47_ = 47,                       /* ','  */
+  YYSYMBOL_48_ = 48,                       /* '.'  */
+  YYSYMBOL_49_ = 49,                       /* '='  */
+  YYSYMBOL_50_ = 50,                       /* '<'  */
+  YYSYMBOL_51_ = 51,                       /* '>'  */
+  YYSYMBOL_52_ = 52,                       /* '*'  */
+  YYSYMBOL_YYACCEPT = 53,                  /* $accept  */
+  YYSYMBOL_start = 54,                     /* start  */
+  YYSYMBOL_stmt = 55,                      /* stmt  */
+  YYSYMBOL_txnStmt = 56,                   /* txnStmt  */
+  YYSYMBOL_dbStmt = 57,                    /* dbStmt  */
+  YYSYMBOL_ddl = 58,                       /* ddl  */
+  YYSYMBOL_dml = 59,                       /* dml  */
+  YYSYMBOL_fieldList = 60,                 /* fieldList  */
+  YYSYMBOL_colNameList = 61,               /* colNameList  */
+  YYSYMBOL_field = 62,                     /* field  */
+  YYSYMBOL_type = 63,                      /* type  */
+  YYSYMBOL_valueRows = 64,                 /* valueRows  */
+  YYSYMBOL_valueList = 65,                 /* valueList  */
+  YYSYMBOL_value = 66,                     /* value  */
+  YYSYMBOL_condition = 67,                 /* condition  */
+  YYSYMBOL_optWhereClause = 68,            /* optWhereClause  */
+  YYSYMBOL_whereClause = 69,               /* whereClause  */
+  YYSYMBOL_col = 70,                       /* col  */
+  YYSYMBOL_colList = 71,                   /* colList  */
+  YYSYMBOL_op = 72,                        /* op  */
+  YYSYMBOL_expr = 73,                      /* expr  */
+  YYSYMBOL_setClauses = 74,                /* setClauses  */
+  YYSYMBOL_setClause = 75,                 /* setClause  */
+  YYSYMBOL_selector = 76,                  /* selector  */
+  YYSYMBOL_tableList = 77,                 /* tableList  */
+  YYSYMBOL_opt_order_clause = 78,          /* opt_order_clause  */
+  YYSYMBOL_order_clause = 79,              /* order_clause  */
+  YYSYMBOL_opt_asc_desc = 80,              /* opt_asc_desc  */
+  YYSYMBOL_tbName = 81,                    /* tbName  */
+  YYSYMBOL_colName = 82                    /* colName  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -306,7 +309,7 @@ typedef int yytype_uint16;
 
 
 /* Stored state numbers (used for stacks). */
-typedef yytype_int8 yy_state_t;
+typedef yytype_uint8 yy_state_t;
 
 /* State numbers in computations.  */
 typedef int yy_state_fast_t;
@@ -518,21 +521,21 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  39
+#define YYFINAL  40
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   112
+#define YYLAST   116
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  51
+#define YYNTOKENS  53
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  29
+#define YYNNTS  30
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  69
+#define YYNRULES  72
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  127
+#define YYNSTATES  134
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   296
+#define YYMAXUTOK   298
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -550,9 +553,9 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      43,    44,    50,     2,    45,     2,    46,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,    42,
-      48,    47,    49,     2,     2,     2,     2,     2,     2,     2,
+      45,    46,    52,     2,    47,     2,    48,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    44,
+      50,    49,    51,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -575,20 +578,21 @@ static const yytype_int8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41
+      35,    36,    37,    38,    39,    40,    41,    42,    43
 };
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,    56,    56,    61,    66,    71,    79,    80,    81,    82,
-      86,    90,    94,    98,   105,   112,   116,   120,   124,   128,
-     135,   139,   143,   147,   154,   158,   165,   169,   176,   183,
-     187,   191,   198,   202,   209,   213,   217,   224,   231,   232,
-     239,   243,   250,   254,   261,   265,   272,   276,   280,   284,
-     288,   292,   299,   303,   310,   314,   321,   328,   332,   336,
-     340,   344,   351,   355,   359,   366,   367,   368,   371,   373
+       0,    57,    57,    62,    67,    72,    80,    81,    82,    83,
+      87,    91,    95,    99,   106,   110,   117,   121,   125,   129,
+     133,   140,   144,   148,   152,   159,   163,   170,   174,   181,
+     188,   192,   196,   203,   207,   214,   218,   225,   229,   233,
+     240,   247,   248,   255,   259,   266,   270,   277,   281,   288,
+     292,   296,   300,   304,   308,   315,   319,   326,   330,   337,
+     344,   348,   352,   356,   360,   367,   371,   375,   382,   383,
+     384,   387,   389
 };
 #endif
 
@@ -604,18 +608,18 @@ static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "\"end of file\"", "error", "\"invalid token\"", "SHOW", "TABLES",
-  "CREATE", "TABLE", "DROP", "DESC", "INSERT", "INTO", "VALUES", "DELETE",
-  "FROM", "ASC", "ORDER", "BY", "WHERE", "UPDATE", "SET", "SELECT", "INT",
-  "CHAR", "FLOAT", "INDEX", "AND", "JOIN", "EXIT", "HELP", "TXN_BEGIN",
-  "TXN_COMMIT", "TXN_ABORT", "TXN_ROLLBACK", "ORDER_BY", "LEQ", "NEQ",
-  "GEQ", "T_EOF", "IDENTIFIER", "VALUE_STRING", "VALUE_INT", "VALUE_FLOAT",
-  "';'", "'('", "')'", "','", "'.'", "'='", "'<'", "'>'", "'*'", "$accept",
-  "start", "stmt", "txnStmt", "dbStmt", "ddl", "dml", "fieldList",
-  "colNameList", "field", "type", "valueList", "value", "condition",
-  "optWhereClause", "whereClause", "col", "colList", "op", "expr",
-  "setClauses", "setClause", "selector", "tableList", "opt_order_clause",
-  "order_clause", "opt_asc_desc", "tbName", "colName", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "SHOW", "TABLES", "IO",
+  "STATS", "CREATE", "TABLE", "DROP", "DESC", "INSERT", "INTO", "VALUES",
+  "DELETE", "FROM", "ASC", "ORDER", "BY", "WHERE", "UPDATE", "SET",
+  "SELECT", "INT", "CHAR", "FLOAT", "INDEX", "AND", "JOIN", "EXIT", "HELP",
+  "TXN_BEGIN", "TXN_COMMIT", "TXN_ABORT", "TXN_ROLLBACK", "ORDER_BY",
+  "LEQ", "NEQ", "GEQ", "T_EOF", "IDENTIFIER", "VALUE_STRING", "VALUE_INT",
+  "VALUE_FLOAT", "';'", "'('", "')'", "','", "'.'", "'='", "'<'", "'>'",
+  "'*'", "$accept", "start", "stmt", "txnStmt", "dbStmt", "ddl", "dml",
+  "fieldList", "colNameList", "field", "type", "valueRows", "valueList",
+  "value", "condition", "optWhereClause", "whereClause", "col", "colList",
+  "op", "expr", "setClauses", "setClause", "selector", "tableList",
+  "opt_order_clause", "order_clause", "opt_asc_desc", "tbName", "colName", YY_NULLPTR
 };
 
 static const char *
@@ -625,12 +629,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-75)
+#define YYPACT_NINF (-78)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-69)
+#define YYTABLE_NINF (-72)
 
 #define yytable_value_is_error(Yyn) \
   0
@@ -639,19 +643,20 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int8 yypact[] =
 {
-      42,    21,     5,     8,    -2,    32,    31,    -2,   -26,   -75,
-     -75,   -75,   -75,   -75,   -75,   -75,    52,     6,   -75,   -75,
-     -75,   -75,   -75,    -2,    -2,    -2,    -2,   -75,   -75,    -2,
-      -2,    34,    13,   -75,   -75,    16,    55,    39,   -75,   -75,
-     -75,    43,    44,   -75,    45,    78,    73,    53,    54,    -2,
-      53,    53,    53,    53,    50,    54,   -75,   -75,    -4,   -75,
-      51,   -75,    -7,   -75,   -75,   -11,   -75,    -5,    22,   -75,
-      33,    24,   -75,    74,    48,    53,   -75,    24,    -2,    -2,
-      85,   -75,    53,   -75,    58,   -75,   -75,   -75,    53,   -75,
-     -75,   -75,   -75,    36,   -75,    54,   -75,   -75,   -75,   -75,
-     -75,   -75,    17,   -75,   -75,   -75,   -75,    86,   -75,   -75,
-      63,   -75,   -75,    24,   -75,   -75,   -75,   -75,    54,    60,
-     -75,     1,   -75,   -75,   -75,   -75,   -75
+      23,    15,     9,    39,   -31,     2,    21,   -31,   -27,   -78,
+     -78,   -78,   -78,   -78,   -78,   -78,    12,    -5,   -78,   -78,
+     -78,   -78,   -78,    45,   -31,   -31,   -31,   -31,   -78,   -78,
+     -31,   -31,    28,    44,   -78,   -78,    33,    75,    46,   -78,
+     -78,   -78,   -78,    48,    50,   -78,    51,    78,    80,    57,
+      60,   -31,    57,    57,    57,    57,    56,    60,   -78,   -78,
+      -1,   -78,    53,   -78,    22,   -78,   -78,    17,   -78,    43,
+      30,   -78,    35,    32,    58,   -78,    76,    34,    57,   -78,
+      32,   -31,   -31,    87,   -78,    57,   -78,    61,   -78,   -78,
+     -78,    57,   -78,   -78,   -78,   -78,    40,   -78,    62,    60,
+     -78,   -78,   -78,   -78,   -78,   -78,    18,   -78,   -78,   -78,
+     -78,    90,   -78,   -78,    67,   -78,   -78,    32,    32,   -78,
+     -78,   -78,   -78,    60,    64,   -78,    42,     0,   -78,   -78,
+     -78,   -78,   -78,   -78
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -661,111 +666,115 @@ static const yytype_int8 yydefact[] =
 {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     4,
        3,    10,    11,    12,    13,     5,     0,     0,     9,     6,
-       7,     8,    14,     0,     0,     0,     0,    68,    17,     0,
-       0,     0,    69,    57,    44,    58,     0,     0,    43,     1,
-       2,     0,     0,    16,     0,     0,    38,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    21,    69,    38,    54,
-       0,    45,    38,    59,    42,     0,    24,     0,     0,    26,
-       0,     0,    40,    39,     0,     0,    22,     0,     0,     0,
-      63,    15,     0,    29,     0,    31,    28,    18,     0,    19,
-      36,    34,    35,     0,    32,     0,    50,    49,    51,    46,
-      47,    48,     0,    55,    56,    61,    60,     0,    23,    25,
-       0,    27,    20,     0,    41,    52,    53,    37,     0,     0,
-      33,    67,    62,    30,    66,    65,    64
+       7,     8,    14,     0,     0,     0,     0,     0,    71,    18,
+       0,     0,     0,    72,    60,    47,    61,     0,     0,    46,
+       1,     2,    15,     0,     0,    17,     0,     0,    41,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    22,    72,
+      41,    57,     0,    48,    41,    62,    45,     0,    25,     0,
+       0,    27,     0,     0,    21,    43,    42,     0,     0,    23,
+       0,     0,     0,    66,    16,     0,    30,     0,    32,    29,
+      19,     0,    20,    39,    37,    38,     0,    35,     0,     0,
+      53,    52,    54,    49,    50,    51,     0,    58,    59,    64,
+      63,     0,    24,    26,     0,    28,    33,     0,     0,    44,
+      55,    56,    40,     0,     0,    36,     0,    70,    65,    31,
+      34,    69,    68,    67
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -75,   -75,   -75,   -75,   -75,   -75,   -75,   -75,    56,    23,
-     -75,   -75,   -74,    11,   -27,   -75,    -8,   -75,   -75,   -75,
-     -75,    37,   -75,   -75,   -75,   -75,   -75,    -3,   -45
+     -78,   -78,   -78,   -78,   -78,   -78,   -78,   -78,    59,    26,
+     -78,   -78,    -6,   -77,    14,   -49,   -78,    -8,   -78,   -78,
+     -78,   -78,    38,   -78,   -78,   -78,   -78,   -78,    -3,   -47
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
+static const yytype_uint8 yydefgoto[] =
 {
-       0,    16,    17,    18,    19,    20,    21,    65,    68,    66,
-      86,    93,    94,    72,    56,    73,    74,    35,   102,   117,
-      58,    59,    36,    62,   108,   122,   126,    37,    38
+       0,    16,    17,    18,    19,    20,    21,    67,    70,    68,
+      89,    74,    96,    97,    75,    58,    76,    77,    36,   106,
+     122,    60,    61,    37,    64,   112,   128,   133,    38,    39
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
    positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_int8 yytable[] =
+static const yytype_int16 yytable[] =
 {
-      34,    28,    60,   104,    31,    64,    67,    69,    69,   124,
-      55,    23,    32,    55,    25,   125,    83,    84,    85,    78,
-      41,    42,    43,    44,    33,    22,    45,    46,   115,    24,
-      60,    76,    26,    81,    82,    80,    27,    67,    79,   120,
-      61,    75,    29,   111,    30,     1,    63,     2,    40,     3,
-       4,     5,    39,    47,     6,    32,    90,    91,    92,   -68,
-       7,    48,     8,    90,    91,    92,    87,    88,    49,     9,
-      10,    11,    12,    13,    14,   105,   106,    89,    88,    15,
-     112,   113,    96,    97,    98,    50,    51,    52,    53,    54,
-      55,    57,    32,    71,   116,    99,   100,   101,    77,    95,
-     107,   110,   118,   119,   123,   109,   114,     0,     0,    70,
-     121,     0,   103
+      35,    29,    62,   108,    32,    66,    69,    71,    71,    28,
+     131,    79,    40,    33,    30,    83,   132,    24,    57,    22,
+      23,    43,    44,    45,    46,    34,     1,    47,    48,   120,
+       2,    62,     3,     4,     5,    25,    31,     6,    69,    41,
+     125,    57,    63,     7,   115,     8,    78,    26,    65,    49,
+      81,    42,     9,    10,    11,    12,    13,    14,    33,    93,
+      94,    95,    15,    84,    85,    27,    86,    87,    88,    82,
+     100,   101,   102,    93,    94,    95,    90,    91,   109,   110,
+      50,    92,    91,   103,   104,   105,   116,   117,   130,   117,
+      51,    56,   -71,    53,    52,    54,    55,    59,   121,    57,
+      33,    73,    80,    99,   111,    98,   114,   118,   123,   124,
+     129,   113,   126,   119,    72,   127,   107
 };
 
 static const yytype_int8 yycheck[] =
 {
-       8,     4,    47,    77,     7,    50,    51,    52,    53,     8,
-      17,     6,    38,    17,     6,    14,    21,    22,    23,    26,
-      23,    24,    25,    26,    50,     4,    29,    30,   102,    24,
-      75,    58,    24,    44,    45,    62,    38,    82,    45,   113,
-      48,    45,    10,    88,    13,     3,    49,     5,    42,     7,
-       8,     9,     0,    19,    12,    38,    39,    40,    41,    46,
-      18,    45,    20,    39,    40,    41,    44,    45,    13,    27,
-      28,    29,    30,    31,    32,    78,    79,    44,    45,    37,
-      44,    45,    34,    35,    36,    46,    43,    43,    43,    11,
-      17,    38,    38,    43,   102,    47,    48,    49,    47,    25,
-      15,    43,    16,    40,    44,    82,    95,    -1,    -1,    53,
-     118,    -1,    75
+       8,     4,    49,    80,     7,    52,    53,    54,    55,    40,
+      10,    60,     0,    40,    12,    64,    16,     8,    19,     4,
+       5,    24,    25,    26,    27,    52,     3,    30,    31,   106,
+       7,    78,     9,    10,    11,    26,    15,    14,    85,    44,
+     117,    19,    50,    20,    91,    22,    47,     8,    51,    21,
+      28,     6,    29,    30,    31,    32,    33,    34,    40,    41,
+      42,    43,    39,    46,    47,    26,    23,    24,    25,    47,
+      36,    37,    38,    41,    42,    43,    46,    47,    81,    82,
+      47,    46,    47,    49,    50,    51,    46,    47,    46,    47,
+      15,    13,    48,    45,    48,    45,    45,    40,   106,    19,
+      40,    45,    49,    27,    17,    47,    45,    45,    18,    42,
+      46,    85,   118,    99,    55,   123,    78
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,     3,     5,     7,     8,     9,    12,    18,    20,    27,
-      28,    29,    30,    31,    32,    37,    52,    53,    54,    55,
-      56,    57,     4,     6,    24,     6,    24,    38,    78,    10,
-      13,    78,    38,    50,    67,    68,    73,    78,    79,     0,
-      42,    78,    78,    78,    78,    78,    78,    19,    45,    13,
-      46,    43,    43,    43,    11,    17,    65,    38,    71,    72,
-      79,    67,    74,    78,    79,    58,    60,    79,    59,    79,
-      59,    43,    64,    66,    67,    45,    65,    47,    26,    45,
-      65,    44,    45,    21,    22,    23,    61,    44,    45,    44,
-      39,    40,    41,    62,    63,    25,    34,    35,    36,    47,
-      48,    49,    69,    72,    63,    78,    78,    15,    75,    60,
-      43,    79,    44,    45,    64,    63,    67,    70,    16,    40,
-      63,    67,    76,    44,     8,    14,    77
+       0,     3,     7,     9,    10,    11,    14,    20,    22,    29,
+      30,    31,    32,    33,    34,    39,    54,    55,    56,    57,
+      58,    59,     4,     5,     8,    26,     8,    26,    40,    81,
+      12,    15,    81,    40,    52,    70,    71,    76,    81,    82,
+       0,    44,     6,    81,    81,    81,    81,    81,    81,    21,
+      47,    15,    48,    45,    45,    45,    13,    19,    68,    40,
+      74,    75,    82,    70,    77,    81,    82,    60,    62,    82,
+      61,    82,    61,    45,    64,    67,    69,    70,    47,    68,
+      49,    28,    47,    68,    46,    47,    23,    24,    25,    63,
+      46,    47,    46,    41,    42,    43,    65,    66,    47,    27,
+      36,    37,    38,    49,    50,    51,    72,    75,    66,    81,
+      81,    17,    78,    62,    45,    82,    46,    47,    45,    67,
+      66,    70,    73,    18,    42,    66,    65,    70,    79,    46,
+      46,    10,    16,    80
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    51,    52,    52,    52,    52,    53,    53,    53,    53,
-      54,    54,    54,    54,    55,    56,    56,    56,    56,    56,
-      57,    57,    57,    57,    58,    58,    59,    59,    60,    61,
-      61,    61,    62,    62,    63,    63,    63,    64,    65,    65,
-      66,    66,    67,    67,    68,    68,    69,    69,    69,    69,
-      69,    69,    70,    70,    71,    71,    72,    73,    73,    74,
-      74,    74,    75,    75,    76,    77,    77,    77,    78,    79
+       0,    53,    54,    54,    54,    54,    55,    55,    55,    55,
+      56,    56,    56,    56,    57,    57,    58,    58,    58,    58,
+      58,    59,    59,    59,    59,    60,    60,    61,    61,    62,
+      63,    63,    63,    64,    64,    65,    65,    66,    66,    66,
+      67,    68,    68,    69,    69,    70,    70,    71,    71,    72,
+      72,    72,    72,    72,    72,    73,    73,    74,    74,    75,
+      76,    76,    77,    77,    77,    78,    78,    79,    80,    80,
+      80,    81,    82
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     6,     3,     2,     6,     6,
-       7,     4,     5,     6,     1,     3,     1,     3,     2,     1,
-       4,     1,     1,     3,     1,     1,     1,     3,     0,     2,
-       1,     3,     3,     1,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     3,     3,     1,     1,     1,
-       3,     3,     3,     0,     2,     1,     1,     0,     1,     1
+       1,     1,     1,     1,     2,     3,     6,     3,     2,     6,
+       6,     5,     4,     5,     6,     1,     3,     1,     3,     2,
+       1,     4,     1,     3,     5,     1,     3,     1,     1,     1,
+       3,     0,     2,     1,     3,     3,     1,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     1,     1,     3,     3,     3,     0,     2,     1,     1,
+       0,     1,     1
 };
 
 
@@ -1621,489 +1630,513 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* start: stmt ';'  */
-#line 57 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 58 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         parse_tree = (yyvsp[-1].sv_node);
         YYACCEPT;
     }
-#line 1630 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1639 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 3: /* start: HELP  */
-#line 62 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 63 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         parse_tree = std::make_shared<Help>();
         YYACCEPT;
     }
-#line 1639 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1648 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 4: /* start: EXIT  */
-#line 67 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 68 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         parse_tree = nullptr;
         YYACCEPT;
     }
-#line 1648 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1657 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 5: /* start: T_EOF  */
-#line 72 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 73 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         parse_tree = nullptr;
         YYACCEPT;
     }
-#line 1657 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1666 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 10: /* txnStmt: TXN_BEGIN  */
-#line 87 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 88 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnBegin>();
     }
-#line 1665 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1674 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 11: /* txnStmt: TXN_COMMIT  */
-#line 91 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 92 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnCommit>();
     }
-#line 1673 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1682 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 12: /* txnStmt: TXN_ABORT  */
-#line 95 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 96 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnAbort>();
     }
-#line 1681 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1690 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 13: /* txnStmt: TXN_ROLLBACK  */
-#line 99 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 100 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnRollback>();
     }
-#line 1689 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1698 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
   case 14: /* dbStmt: SHOW TABLES  */
-#line 106 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 107 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<ShowTables>();
     }
-#line 1697 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1706 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 15: /* ddl: CREATE TABLE tbName '(' fieldList ')'  */
-#line 113 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 15: /* dbStmt: SHOW IO STATS  */
+#line 111 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+    {
+        (yyval.sv_node) = std::make_shared<ShowIOStats>();
+    }
+#line 1714 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+    break;
+
+  case 16: /* ddl: CREATE TABLE tbName '(' fieldList ')'  */
+#line 118 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<CreateTable>((yyvsp[-3].sv_str), (yyvsp[-1].sv_fields));
     }
-#line 1705 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1722 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 16: /* ddl: DROP TABLE tbName  */
-#line 117 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 17: /* ddl: DROP TABLE tbName  */
+#line 122 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DropTable>((yyvsp[0].sv_str));
     }
-#line 1713 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1730 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 17: /* ddl: DESC tbName  */
-#line 121 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 18: /* ddl: DESC tbName  */
+#line 126 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DescTable>((yyvsp[0].sv_str));
     }
-#line 1721 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1738 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 18: /* ddl: CREATE INDEX tbName '(' colNameList ')'  */
-#line 125 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 19: /* ddl: CREATE INDEX tbName '(' colNameList ')'  */
+#line 130 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<CreateIndex>((yyvsp[-3].sv_str), (yyvsp[-1].sv_strs));
     }
-#line 1729 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1746 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 19: /* ddl: DROP INDEX tbName '(' colNameList ')'  */
-#line 129 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 20: /* ddl: DROP INDEX tbName '(' colNameList ')'  */
+#line 134 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DropIndex>((yyvsp[-3].sv_str), (yyvsp[-1].sv_strs));
     }
-#line 1737 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1754 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 20: /* dml: INSERT INTO tbName VALUES '(' valueList ')'  */
-#line 136 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 21: /* dml: INSERT INTO tbName VALUES valueRows  */
+#line 141 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
-        (yyval.sv_node) = std::make_shared<InsertStmt>((yyvsp[-4].sv_str), (yyvsp[-1].sv_vals));
+        (yyval.sv_node) = std::make_shared<InsertStmt>((yyvsp[-2].sv_str), (yyvsp[0].sv_val_rows));
     }
-#line 1745 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1762 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 21: /* dml: DELETE FROM tbName optWhereClause  */
-#line 140 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 22: /* dml: DELETE FROM tbName optWhereClause  */
+#line 145 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DeleteStmt>((yyvsp[-1].sv_str), (yyvsp[0].sv_conds));
     }
-#line 1753 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1770 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 22: /* dml: UPDATE tbName SET setClauses optWhereClause  */
-#line 144 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 23: /* dml: UPDATE tbName SET setClauses optWhereClause  */
+#line 149 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<UpdateStmt>((yyvsp[-3].sv_str), (yyvsp[-1].sv_set_clauses), (yyvsp[0].sv_conds));
     }
-#line 1761 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1778 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 23: /* dml: SELECT selector FROM tableList optWhereClause opt_order_clause  */
-#line 148 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 24: /* dml: SELECT selector FROM tableList optWhereClause opt_order_clause  */
+#line 153 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<SelectStmt>((yyvsp[-4].sv_cols), (yyvsp[-2].sv_strs), (yyvsp[-1].sv_conds), (yyvsp[0].sv_orderby));
     }
-#line 1769 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1786 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 24: /* fieldList: field  */
-#line 155 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 25: /* fieldList: field  */
+#line 160 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_fields) = std::vector<std::shared_ptr<Field>>{(yyvsp[0].sv_field)};
     }
-#line 1777 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1794 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 25: /* fieldList: fieldList ',' field  */
-#line 159 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 26: /* fieldList: fieldList ',' field  */
+#line 164 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_fields).push_back((yyvsp[0].sv_field));
     }
-#line 1785 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1802 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 26: /* colNameList: colName  */
-#line 166 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 27: /* colNameList: colName  */
+#line 171 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_strs) = std::vector<std::string>{(yyvsp[0].sv_str)};
     }
-#line 1793 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1810 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 27: /* colNameList: colNameList ',' colName  */
-#line 170 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 28: /* colNameList: colNameList ',' colName  */
+#line 175 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 1801 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1818 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 28: /* field: colName type  */
-#line 177 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 29: /* field: colName type  */
+#line 182 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_field) = std::make_shared<ColDef>((yyvsp[-1].sv_str), (yyvsp[0].sv_type_len));
     }
-#line 1809 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1826 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 29: /* type: INT  */
-#line 184 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 30: /* type: INT  */
+#line 189 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_INT, sizeof(int));
     }
-#line 1817 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1834 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 30: /* type: CHAR '(' VALUE_INT ')'  */
-#line 188 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 31: /* type: CHAR '(' VALUE_INT ')'  */
+#line 193 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_STRING, (yyvsp[-1].sv_int));
     }
-#line 1825 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1842 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 31: /* type: FLOAT  */
-#line 192 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 32: /* type: FLOAT  */
+#line 197 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
     }
-#line 1833 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1850 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+    break;
+
+  case 33: /* valueRows: '(' valueList ')'  */
+#line 204 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+    {
+        (yyval.sv_val_rows) = std::vector<std::vector<std::shared_ptr<Value>>>{(yyvsp[-1].sv_vals)};
+    }
+#line 1858 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 32: /* valueList: value  */
-#line 199 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 34: /* valueRows: valueRows ',' '(' valueList ')'  */
+#line 208 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+    {
+        (yyval.sv_val_rows).push_back((yyvsp[-1].sv_vals));
+    }
+#line 1866 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+    break;
+
+  case 35: /* valueList: value  */
+#line 215 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_vals) = std::vector<std::shared_ptr<Value>>{(yyvsp[0].sv_val)};
     }
-#line 1841 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1874 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 33: /* valueList: valueList ',' value  */
-#line 203 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 36: /* valueList: valueList ',' value  */
+#line 219 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_vals).push_back((yyvsp[0].sv_val));
     }
-#line 1849 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1882 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 34: /* value: VALUE_INT  */
-#line 210 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 37: /* value: VALUE_INT  */
+#line 226 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<IntLit>((yyvsp[0].sv_int));
     }
-#line 1857 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1890 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 35: /* value: VALUE_FLOAT  */
-#line 214 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 38: /* value: VALUE_FLOAT  */
+#line 230 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<FloatLit>((yyvsp[0].sv_float));
     }
-#line 1865 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1898 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 36: /* value: VALUE_STRING  */
-#line 218 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 39: /* value: VALUE_STRING  */
+#line 234 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<StringLit>((yyvsp[0].sv_str));
     }
-#line 1873 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1906 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 37: /* condition: col op expr  */
-#line 225 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 40: /* condition: col op expr  */
+#line 241 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_cond) = std::make_shared<BinaryExpr>((yyvsp[-2].sv_col), (yyvsp[-1].sv_comp_op), (yyvsp[0].sv_expr));
     }
-#line 1881 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1914 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 38: /* optWhereClause: %empty  */
-#line 231 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 41: /* optWhereClause: %empty  */
+#line 247 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
                       { /* ignore*/ }
-#line 1887 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1920 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 39: /* optWhereClause: WHERE whereClause  */
-#line 233 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 42: /* optWhereClause: WHERE whereClause  */
+#line 249 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_conds) = (yyvsp[0].sv_conds);
     }
-#line 1895 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1928 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 40: /* whereClause: condition  */
-#line 240 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 43: /* whereClause: condition  */
+#line 256 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_conds) = std::vector<std::shared_ptr<BinaryExpr>>{(yyvsp[0].sv_cond)};
     }
-#line 1903 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1936 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 41: /* whereClause: whereClause AND condition  */
-#line 244 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 44: /* whereClause: whereClause AND condition  */
+#line 260 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_conds).push_back((yyvsp[0].sv_cond));
     }
-#line 1911 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1944 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 42: /* col: tbName '.' colName  */
-#line 251 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 45: /* col: tbName '.' colName  */
+#line 267 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_col) = std::make_shared<Col>((yyvsp[-2].sv_str), (yyvsp[0].sv_str));
     }
-#line 1919 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1952 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 43: /* col: colName  */
-#line 255 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 46: /* col: colName  */
+#line 271 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_col) = std::make_shared<Col>("", (yyvsp[0].sv_str));
     }
-#line 1927 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1960 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 44: /* colList: col  */
-#line 262 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 47: /* colList: col  */
+#line 278 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_cols) = std::vector<std::shared_ptr<Col>>{(yyvsp[0].sv_col)};
     }
-#line 1935 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1968 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 45: /* colList: colList ',' col  */
-#line 266 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 48: /* colList: colList ',' col  */
+#line 282 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_cols).push_back((yyvsp[0].sv_col));
     }
-#line 1943 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1976 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 46: /* op: '='  */
-#line 273 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 49: /* op: '='  */
+#line 289 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_EQ;
     }
-#line 1951 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1984 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 47: /* op: '<'  */
-#line 277 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 50: /* op: '<'  */
+#line 293 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_LT;
     }
-#line 1959 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 1992 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 48: /* op: '>'  */
-#line 281 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 51: /* op: '>'  */
+#line 297 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_GT;
     }
-#line 1967 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2000 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 49: /* op: NEQ  */
-#line 285 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 52: /* op: NEQ  */
+#line 301 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_NE;
     }
-#line 1975 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2008 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 50: /* op: LEQ  */
-#line 289 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 53: /* op: LEQ  */
+#line 305 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_LE;
     }
-#line 1983 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2016 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 51: /* op: GEQ  */
-#line 293 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 54: /* op: GEQ  */
+#line 309 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_GE;
     }
-#line 1991 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2024 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 52: /* expr: value  */
-#line 300 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 55: /* expr: value  */
+#line 316 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_expr) = std::static_pointer_cast<Expr>((yyvsp[0].sv_val));
     }
-#line 1999 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2032 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 53: /* expr: col  */
-#line 304 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 56: /* expr: col  */
+#line 320 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_expr) = std::static_pointer_cast<Expr>((yyvsp[0].sv_col));
     }
-#line 2007 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2040 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 54: /* setClauses: setClause  */
-#line 311 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 57: /* setClauses: setClause  */
+#line 327 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_set_clauses) = std::vector<std::shared_ptr<SetClause>>{(yyvsp[0].sv_set_clause)};
     }
-#line 2015 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2048 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 55: /* setClauses: setClauses ',' setClause  */
-#line 315 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 58: /* setClauses: setClauses ',' setClause  */
+#line 331 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_set_clauses).push_back((yyvsp[0].sv_set_clause));
     }
-#line 2023 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2056 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 56: /* setClause: colName '=' value  */
-#line 322 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 59: /* setClause: colName '=' value  */
+#line 338 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_set_clause) = std::make_shared<SetClause>((yyvsp[-2].sv_str), (yyvsp[0].sv_val));
     }
-#line 2031 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2064 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 57: /* selector: '*'  */
-#line 329 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 60: /* selector: '*'  */
+#line 345 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_cols) = {};
     }
-#line 2039 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2072 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 59: /* tableList: tbName  */
-#line 337 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 62: /* tableList: tbName  */
+#line 353 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_strs) = std::vector<std::string>{(yyvsp[0].sv_str)};
     }
-#line 2047 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2080 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 60: /* tableList: tableList ',' tbName  */
-#line 341 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 63: /* tableList: tableList ',' tbName  */
+#line 357 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 2055 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2088 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 61: /* tableList: tableList JOIN tbName  */
-#line 345 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 64: /* tableList: tableList JOIN tbName  */
+#line 361 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 2063 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2096 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 62: /* opt_order_clause: ORDER BY order_clause  */
-#line 352 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 65: /* opt_order_clause: ORDER BY order_clause  */
+#line 368 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     { 
         (yyval.sv_orderby) = (yyvsp[0].sv_orderby); 
     }
-#line 2071 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2104 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 63: /* opt_order_clause: %empty  */
-#line 355 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 66: /* opt_order_clause: %empty  */
+#line 371 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
                       { /* ignore*/ }
-#line 2077 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2110 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 64: /* order_clause: col opt_asc_desc  */
-#line 360 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 67: /* order_clause: col opt_asc_desc  */
+#line 376 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
     { 
         (yyval.sv_orderby) = std::make_shared<OrderBy>((yyvsp[-1].sv_col), (yyvsp[0].sv_orderby_dir));
     }
-#line 2085 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2118 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 65: /* opt_asc_desc: ASC  */
-#line 366 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 68: /* opt_asc_desc: ASC  */
+#line 382 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
                  { (yyval.sv_orderby_dir) = OrderBy_ASC;     }
-#line 2091 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2124 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 66: /* opt_asc_desc: DESC  */
-#line 367 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 69: /* opt_asc_desc: DESC  */
+#line 383 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
                  { (yyval.sv_orderby_dir) = OrderBy_DESC;    }
-#line 2097 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2130 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
-  case 67: /* opt_asc_desc: %empty  */
-#line 368 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+  case 70: /* opt_asc_desc: %empty  */
+#line 384 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
             { (yyval.sv_orderby_dir) = OrderBy_DEFAULT; }
-#line 2103 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2136 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
     break;
 
 
-#line 2107 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
+#line 2140 "/home/rucbase/rucbase-lab/src/parser/yacc.tab.cpp"
 
       default: break;
     }
@@ -2332,5 +2365,5 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 374 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
+#line 390 "/home/rucbase/rucbase-lab/src/parser/yacc.y"
 
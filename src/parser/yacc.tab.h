@@ -56,43 +56,45 @@ extern int yydebug;
     YYUNDEF = 257,                 /* "invalid token"  */
     SHOW = 258,                    /* SHOW  */
     TABLES = 259,                  /* TABLES  */
-    CREATE = 260,                  /* CREATE  */
-    TABLE = 261,                   /* TABLE  */
-    DROP = 262,                    /* DROP  */
-    DESC = 263,                    /* DESC  */
-    INSERT = 264,                  /* INSERT  */
-    INTO = 265,                    /* INTO  */
-    VALUES = 266,                  /* VALUES  */
-    DELETE = 267,                  /* DELETE  */
-    FROM = 268,                    /* FROM  */
-    ASC = 269,                     /* ASC  */
-    ORDER = 270,                   /* ORDER  */
-    BY = 271,                      /* BY  */
-    WHERE = 272,                   /* WHERE  */
-    UPDATE = 273,                  /* UPDATE  */
-    SET = 274,                     /* SET  */
-    SELECT = 275,                  /* SELECT  */
-    INT = 276,                     /* INT  */
-    CHAR = 277,                    /* CHAR  */
-    FLOAT = 278,                   /* FLOAT  */
-    INDEX = 279,                   /* INDEX  */
-    AND = 280,                     /* AND  */
-    JOIN = 281,                    /* JOIN  */
-    EXIT = 282,                    /* EXIT  */
-    HELP = 283,                    /* HELP  */
-    TXN_BEGIN = 284,               /* TXN_BEGIN  */
-    TXN_COMMIT = 285,              /* TXN_COMMIT  */
-    TXN_ABORT = 286,               /* TXN_ABORT  */
-    TXN_ROLLBACK = 287,            /* TXN_ROLLBACK  */
-    ORDER_BY = 288,                /* ORDER_BY  */
-    LEQ = 289,                     /* LEQ  */
-    NEQ = 290,                     /* NEQ  */
-    GEQ = 291,                     /* GEQ  */
-    T_EOF = 292,                   /* T_EOF  */
-    IDENTIFIER = 293,              /* IDENTIFIER  */
-    VALUE_STRING = 294,            /* VALUE_STRING  */
-    VALUE_INT = 295,               /* VALUE_INT  */
-    VALUE_FLOAT = 296              /* VALUE_FLOAT  */
+    IO = 260,                      /* IO  */
+    STATS = 261,                   /* STATS  */
+    CREATE = 262,                  /* CREATE  */
+    TABLE = 263,                   /* TABLE  */
+    DROP = 264,                    /* DROP  */
+    DESC = 265,                    /* DESC  */
+    INSERT = 266,                  /* INSERT  */
+    INTO = 267,                    /* INTO  */
+    VALUES = 268,                  /* VALUES  */
+    DELETE = 269,                  /* DELETE  */
+    FROM = 270,                    /* FROM  */
+    ASC = 271,                     /* ASC  */
+    ORDER = 272,                   /* ORDER  */
+    BY = 273,                      /* BY  */
+    WHERE = 274,                   /* WHERE  */
+    UPDATE = 275,                  /* UPDATE  */
+    SET = 276,                     /* SET  */
+    SELECT = 277,                  /* SELECT  */
+    INT = 278,                     /* INT  */
+    CHAR = 279,                    /* CHAR  */
+    FLOAT = 280,                   /* FLOAT  */
+    INDEX = 281,                   /* INDEX  */
+    AND = 282,                     /* AND  */
+    JOIN = 283,                    /* JOIN  */
+    EXIT = 284,                    /* EXIT  */
+    HELP = 285,                    /* HELP  */
+    TXN_BEGIN = 286,               /* TXN_BEGIN  */
+    TXN_COMMIT = 287,              /* TXN_COMMIT  */
+    TXN_ABORT = 288,               /* TXN_ABORT  */
+    TXN_ROLLBACK = 289,            /* TXN_ROLLBACK  */
+    ORDER_BY = 290,                /* ORDER_BY  */
+    LEQ = 291,                     /* LEQ  */
+    NEQ = 292,                     /* NEQ  */
+    GEQ = 293,                     /* GEQ  */
+    T_EOF = 294,                   /* T_EOF  */
+    IDENTIFIER = 295,              /* IDENTIFIER  */
+    VALUE_STRING = 296,            /* VALUE_STRING  */
+    VALUE_INT = 297,               /* VALUE_INT  */
+    VALUE_FLOAT = 298              /* VALUE_FLOAT  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -10,6 +10,7 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 
@@ -24,6 +25,21 @@ class Bitmap {
     // pos位 置1
     static void set(char *bm, int pos) { bm[get_bucket(pos)] |= get_bit(pos); }
 
+    // [begin,end)范围内的位 置1，中间的整字节一次写入
+    static void set_range(char *bm, int begin, int end) {
+        while (begin < end && begin % BITMAP_WIDTH != 0) {
+            set(bm, begin++);
+        }
+        int full_bytes = (end - begin) / BITMAP_WIDTH;
+        if (full_bytes > 0) {
+            memset(bm + get_bucket(begin), 0xff, full_bytes);
+            begin += full_bytes * BITMAP_WIDTH;
+        }
+        while (begin < end) {
+            set(bm, begin++);
+        }
+    }
+
     // pos位 置0
     static void reset(char *bm, int pos) { bm[get_bucket(pos)] &= static_cast<char>(~get_bit(pos)); }
 
@@ -31,7 +47,7 @@ class Bitmap {
     static bool is_set(const char *bm, int pos) { return (bm[get_bucket(pos)] & get_bit(pos)) != 0; }
 
     /**
-     * @brief 找下一个为0 or 1的位
+     * @brief 找下一个为0 or 1的位，每次检查64位
      * @param bit false表示要找下一个为0的位，true表示要找下一个为1的位
      * @param bm 要找的起始地址为bm
      * @param max_n 要找的从起始地址开始的偏移为[curr+1,max_n)
@@ -39,22 +55,73 @@ class Bitmap {
      * @return 找到了就返回偏移位置，没找到就返回max_n
      */
     static int next_bit(bool bit, const char *bm, int max_n, int curr) {
-        for (int i = curr + 1; i < max_n; i++) {
-            if (is_set(bm, i) == bit) {
-                return i;
+        int pos = curr + 1;
+        if (pos >= max_n) {
+            return max_n;
+        }
+        const int num_bytes = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        int byte = get_bucket(pos);
+        uint64_t word = load_word(bm, byte, num_bytes, bit) & (~0ull >> (pos % BITMAP_WIDTH));
+        while (word == 0) {
+            byte += WORD_BYTES;
+            if (byte >= num_bytes) {
+                return max_n;
             }
+            word = load_word(bm, byte, num_bytes, bit);
         }
-        return max_n;
+        // max_n之后的位可能被读到，此时视为没找到
+        return std::min(byte * BITMAP_WIDTH + __builtin_clzll(word), max_n);
     }
 
     // 找第一个为0 or 1的位
     static int first_bit(bool bit, const char *bm, int max_n) { return next_bit(bit, bm, max_n, -1); }
 
+    // 统计[0,max_n)中为1的位的个数
+    static int count(const char *bm, int max_n) {
+        const int num_bytes = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        int cnt = 0;
+        int byte = 0;
+        for (; (byte + WORD_BYTES) * BITMAP_WIDTH <= max_n; byte += WORD_BYTES) {
+            cnt += __builtin_popcountll(load_word(bm, byte, num_bytes, true));
+        }
+        if (byte < num_bytes) {
+            // 最后一个字去掉max_n之后的位
+            int tail = max_n - byte * BITMAP_WIDTH;
+            cnt += __builtin_popcountll(load_word(bm, byte, num_bytes, true) & ~(~0ull >> tail));
+        }
+        return cnt;
+    }
+
     // for example:
     // rid_.slot_no = Bitmap::next_bit(true, page_handle.bitmap, file_handle_->file_hdr_.num_records_per_page,
     // rid_.slot_no); int slot_no = Bitmap::first_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page);
 
    private:
+    static constexpr int WORD_BYTES = 8;
+
+    /**
+     * @brief 读取从第byte个字节开始的8个字节，第byte*8位放在最高位，与按字节的位序一致。
+     * [num_bytes, byte+8)范围内的字节不读取，视为全0
+     * @param bit 为false时按位取反，要找的位变成1
+     */
+    static uint64_t load_word(const char *bm, int byte, int num_bytes, bool bit) {
+        uint64_t word = 0;
+        int n = num_bytes - byte;
+        if (n >= WORD_BYTES) {
+            memcpy(&word, bm + byte, WORD_BYTES);
+        } else {
+            memcpy(&word, bm + byte, n);
+        }
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        if (!bit) {
+            word = ~word;
+            if (n < WORD_BYTES) word &= ~(~0ull >> (n * BITMAP_WIDTH));
+        }
+        return word;
+    }
+
     static int get_bucket(int pos) { return pos / BITMAP_WIDTH; }
 
     static char get_bit(int pos) { return BITMAP_HIGHEST_BIT >> static_cast<char>(pos % BITMAP_WIDTH); }
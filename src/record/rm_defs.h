@@ -10,6 +10,9 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <memory>
+
+#include "common/tuple_arena.h"
 #include "defs.h"
 #include "storage/buffer_pool_manager.h"
 
@@ -35,8 +38,8 @@ struct RmPageHdr {
 
 /* 表中的记录 */
 struct RmRecord {
-    char* data;  // 记录的数据
-    int size;    // 记录的大小
+    char* data = nullptr;  // 记录的数据
+    int size = 0;          // 记录的大小
     bool allocated_ = false;    // 是否已经为数据分配空间
 
     RmRecord() = default;
@@ -69,6 +72,13 @@ struct RmRecord {
         allocated_ = true;
     }
 
+    // 数据的空间从arena中分配，由arena统一释放
+    RmRecord(int size_, TupleArena* arena) {
+        size = size_;
+        data = arena->allocate(size_);
+        allocated_ = false;
+    }
+
     void SetData(char* data_) {
         memcpy(data, data_, size);
     }
@@ -90,3 +100,40 @@ struct RmRecord {
         data = nullptr;
     }
 };
+
+/**
+ * @description: 记录的只读视图，直接指向缓冲池帧中的槽或执行器的输出缓冲区，不复制记录。
+ * owner_使数据所在的内存在视图存活期间保持有效，例如页面的pin，多个视图可以共享同一个owner_；
+ * owner_为空时数据只在产生视图的执行器下一次移动之前有效。需要长期保存记录时调用materialize复制
+ */
+class RecordView {
+    std::shared_ptr<const void> owner_;
+    const char *data_ = nullptr;
+    int size_ = 0;
+
+   public:
+    RecordView() = default;
+
+    RecordView(const char *data, int size, std::shared_ptr<const void> owner = nullptr)
+        : owner_(std::move(owner)), data_(data), size_(size) {}
+
+    bool is_valid() const { return data_ != nullptr; }
+
+    const char *data() const { return data_; }
+
+    int size() const { return size_; }
+
+    /**
+     * @description: 将记录复制到新的RmRecord中，返回的记录不依赖视图
+     * @param {TupleArena*} arena 不为nullptr时记录的数据从arena中分配，在arena reset之前有效
+     */
+    std::unique_ptr<RmRecord> materialize(TupleArena *arena = nullptr) const {
+        if (data_ == nullptr) return nullptr;
+        if (arena == nullptr) {
+            return std::make_unique<RmRecord>(size_, const_cast<char *>(data_));
+        }
+        auto rec = std::make_unique<RmRecord>(size_, arena);
+        memcpy(rec->data, data_, size_);
+        return rec;
+    }
+};
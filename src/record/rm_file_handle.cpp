@@ -33,13 +33,33 @@ std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid &rid, Context *cont
              throw TransactionAbortException(context->txn_->get_transaction_id(), AbortReason::DEADLOCK_PREVENTION);
         }
     }
-    RmPageHandle ph = fetch_page_handle(rid.page_no);
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle ph(&file_hdr_, guard.get_page());
     char *slot = ph.get_slot(rid.slot_no);
     auto rec = std::make_unique<RmRecord>(file_hdr_.record_size);
     memcpy(rec->data, slot, file_hdr_.record_size);
     return rec;
 }
 
+/**
+ * @description: 与get_record相同，但不复制记录：返回的视图只持有页面的pin，直接指向页面中的槽
+ * @note 视图不持有页面锁，记录的内容由这里加的记录S锁（或调用者持有的表锁）保证不被其他事务修改
+ */
+RecordView RmFileHandle::get_record_view(const Rid &rid, Context *context) const {
+    if (context != nullptr && context->txn_ != nullptr) {
+        if (!context->lock_mgr_->lock_IS_on_table(context->txn_, fd_)) {
+             throw TransactionAbortException(context->txn_->get_transaction_id(), AbortReason::DEADLOCK_PREVENTION);
+        }
+        if (!context->lock_mgr_->lock_shared_on_record(context->txn_, rid, fd_)) {
+             throw TransactionAbortException(context->txn_->get_transaction_id(), AbortReason::DEADLOCK_PREVENTION);
+        }
+    }
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle ph(&file_hdr_, guard.get_page());
+    const char *slot = ph.get_slot(rid.slot_no);
+    return RecordView(slot, file_hdr_.record_size, std::make_shared<PageGuard>(guard.unlatch()));
+}
+
 Rid RmFileHandle::insert_record(char *buf, Context *context) {
     if (context != nullptr && context->txn_ != nullptr) {
         if (!context->lock_mgr_->lock_IX_on_table(context->txn_, fd_)) {
@@ -47,7 +67,8 @@ Rid RmFileHandle::insert_record(char *buf, Context *context) {
         }
     }
 
-    RmPageHandle ph = create_page_handle();
+    WritePageGuard guard = create_page_guard();
+    RmPageHandle ph(&file_hdr_, guard.get_page());
     int slot_no = Bitmap::first_bit(false, ph.bitmap, file_hdr_.num_records_per_page);
     Rid rid = {ph.page->get_page_id().page_no, slot_no};
 
@@ -57,11 +78,6 @@ Rid RmFileHandle::insert_record(char *buf, Context *context) {
         }
     }
 
-    if (context != nullptr && context->txn_ != nullptr) {
-        auto *wr = new WriteRecord(WType::INSERT_TUPLE, table_name_, rid);
-        context->txn_->append_write_record(wr);
-    }
-
     char *slot = ph.get_slot(slot_no);
     memcpy(slot, buf, file_hdr_.record_size);
     Bitmap::set(ph.bitmap, slot_no);
@@ -70,12 +86,67 @@ Rid RmFileHandle::insert_record(char *buf, Context *context) {
     if (ph.page_hdr->num_records == file_hdr_.num_records_per_page) {
         release_page_handle(ph);
     }
-    buffer_pool_manager_->unpin_page(ph.page->get_page_id(), true);
     return rid;
 }
 
+/**
+ * @description: 批量插入记录。每次固定一个有空闲槽位的页面并尽量填满，连续的空闲槽位用一次memcpy写入、
+ * 一次设置位图；每个页面只产生一条写操作记录。对整个表加X锁，不再逐条加记录锁
+ * @param {const char*} buf 连续存放的num_records条记录
+ * @param {int} num_records 记录条数
+ * @param {vector<Rid>*} rids 按buf中的顺序追加插入位置
+ * @param {Context*} context
+ */
+void RmFileHandle::insert_records(const char *buf, int num_records, std::vector<Rid> *rids, Context *context) {
+    if (context != nullptr && context->txn_ != nullptr) {
+        if (!context->lock_mgr_->lock_exclusive_on_table(context->txn_, fd_)) {
+             throw TransactionAbortException(context->txn_->get_transaction_id(), AbortReason::DEADLOCK_PREVENTION);
+        }
+    }
+
+    const int record_size = file_hdr_.record_size;
+    const int num_records_per_page = file_hdr_.num_records_per_page;
+    int inserted = 0;
+    while (inserted < num_records) {
+        WritePageGuard guard = create_page_guard();
+        RmPageHandle ph(&file_hdr_, guard.get_page());
+        const int page_no = ph.page->get_page_id().page_no;
+        const int first = inserted;
+        std::vector<int> slot_nos;
+        int slot = Bitmap::first_bit(false, ph.bitmap, num_records_per_page);
+        while (slot < num_records_per_page && inserted < num_records) {
+            // 从slot开始的一段连续空闲槽位
+            int end = std::min(Bitmap::next_bit(true, ph.bitmap, num_records_per_page, slot),
+                               slot + (num_records - inserted));
+            memcpy(ph.get_slot(slot), buf + static_cast<size_t>(inserted) * record_size,
+                   static_cast<size_t>(end - slot) * record_size);
+            Bitmap::set_range(ph.bitmap, slot, end);
+            for (int s = slot; s < end; s++) {
+                slot_nos.push_back(s);
+                rids->push_back(Rid{page_no, s});
+            }
+            inserted += end - slot;
+            slot = Bitmap::next_bit(false, ph.bitmap, num_records_per_page, end - 1);
+        }
+        ph.page_hdr->num_records += inserted - first;
+
+        if (context != nullptr && context->txn_ != nullptr) {
+            // 这些记录在buf中是连续的，一起保存用于回滚
+            RmRecord records((inserted - first) * record_size,
+                             const_cast<char *>(buf + static_cast<size_t>(first) * record_size));
+            context->txn_->append_write_record(
+                new WriteRecord(WType::INSERT_PAGE, table_name_, page_no, std::move(slot_nos), records));
+        }
+
+        if (ph.page_hdr->num_records == num_records_per_page) {
+            release_page_handle(ph);
+        }
+    }
+}
+
 void RmFileHandle::insert_record(const Rid &rid, char *buf) {
-    RmPageHandle ph = fetch_page_handle(rid.page_no);
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle ph(&file_hdr_, guard.get_page());
     Bitmap::set(ph.bitmap, rid.slot_no);
     ph.page_hdr->num_records++;
     char *slot = ph.get_slot(rid.slot_no);
@@ -83,7 +154,6 @@ void RmFileHandle::insert_record(const Rid &rid, char *buf) {
     if (ph.page_hdr->num_records == file_hdr_.num_records_per_page) {
         release_page_handle(ph);
     }
-    buffer_pool_manager_->unpin_page(ph.page->get_page_id(), true);
 }
 
 void RmFileHandle::delete_record(const Rid &rid, Context *context) {
@@ -96,7 +166,8 @@ void RmFileHandle::delete_record(const Rid &rid, Context *context) {
         }
     }
 
-    RmPageHandle ph = fetch_page_handle(rid.page_no);
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle ph(&file_hdr_, guard.get_page());
     
     if (context != nullptr && context->txn_ != nullptr) {
         char *slot = ph.get_slot(rid.slot_no);
@@ -113,7 +184,6 @@ void RmFileHandle::delete_record(const Rid &rid, Context *context) {
         ph.page_hdr->next_free_page_no = file_hdr_.first_free_page_no;
         file_hdr_.first_free_page_no = ph.page->get_page_id().page_no;
     }
-    buffer_pool_manager_->unpin_page(ph.page->get_page_id(), true);
 }
 
 void RmFileHandle::update_record(const Rid &rid, char *buf, Context *context) {
@@ -126,7 +196,8 @@ void RmFileHandle::update_record(const Rid &rid, char *buf, Context *context) {
         }
     }
 
-    RmPageHandle ph = fetch_page_handle(rid.page_no);
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle ph(&file_hdr_, guard.get_page());
     char *slot = ph.get_slot(rid.slot_no);
 
     if (context != nullptr && context->txn_ != nullptr) {
@@ -138,15 +209,32 @@ void RmFileHandle::update_record(const Rid &rid, char *buf, Context *context) {
     }
 
     memcpy(slot, buf, file_hdr_.record_size);
-    buffer_pool_manager_->unpin_page(ph.page->get_page_id(), true);
 }
 
-RmPageHandle RmFileHandle::fetch_page_handle(int page_no) const {
-    Page *page = buffer_pool_manager_->fetch_page({fd_, page_no});
+RmPageHandle RmFileHandle::fetch_page_handle(int page_no, BufferAccessStrategy *strategy) const {
+    Page *page = buffer_pool_manager_->fetch_page({fd_, page_no}, strategy);
     if (!page) throw PageNotExistError("RmFileHandle", page_no);
     return RmPageHandle(&file_hdr_, page);
 }
 
+/**
+ * @description: 获取页面并加读锁，页面不存在时抛出异常
+ */
+ReadPageGuard RmFileHandle::fetch_page_read(int page_no, BufferAccessStrategy *strategy) const {
+    ReadPageGuard guard = buffer_pool_manager_->fetch_page_read({fd_, page_no}, strategy);
+    if (!guard.is_valid()) throw PageNotExistError("RmFileHandle", page_no);
+    return guard;
+}
+
+/**
+ * @description: 获取页面并加写锁，页面不存在时抛出异常
+ */
+WritePageGuard RmFileHandle::fetch_page_write(int page_no) const {
+    WritePageGuard guard = buffer_pool_manager_->fetch_page_write({fd_, page_no});
+    if (!guard.is_valid()) throw PageNotExistError("RmFileHandle", page_no);
+    return guard;
+}
+
 RmPageHandle RmFileHandle::create_new_page_handle() {
     PageId new_page_id{fd_, 0};
     Page *page = buffer_pool_manager_->new_page(&new_page_id);
@@ -162,18 +250,22 @@ RmPageHandle RmFileHandle::create_new_page_handle() {
     return RmPageHandle(&file_hdr_, page);
 }
 
-RmPageHandle RmFileHandle::create_page_handle() {
+/**
+ * @description: 获取一个有空闲槽位的页面并加写锁，没有时创建新页面
+ * @note 在写锁内检查空闲槽位，保证返回时页面仍有空闲槽位
+ */
+WritePageGuard RmFileHandle::create_page_guard() {
     int page_no = file_hdr_.first_free_page_no;
     while (page_no != RM_NO_PAGE) {
-        RmPageHandle ph = fetch_page_handle(page_no);
-        int slot = Bitmap::first_bit(false, ph.bitmap, file_hdr_.num_records_per_page);
-        if (slot < file_hdr_.num_records_per_page) {
-            return ph;
+        WritePageGuard guard = fetch_page_write(page_no);
+        RmPageHandle ph(&file_hdr_, guard.get_page());
+        if (ph.page_hdr->num_records < file_hdr_.num_records_per_page) {
+            return guard;
         }
         page_no = ph.page_hdr->next_free_page_no;
-        buffer_pool_manager_->unpin_page(ph.page->get_page_id(), false);
     }
-    return create_new_page_handle();
+    RmPageHandle ph = create_new_page_handle();
+    return WritePageGuard(buffer_pool_manager_, ph.page);
 }
 
 void RmFileHandle::release_page_handle(RmPageHandle &ph) {
@@ -183,15 +275,13 @@ void RmFileHandle::release_page_handle(RmPageHandle &ph) {
     } else {
         int prev = file_hdr_.first_free_page_no;
         while (prev != RM_NO_PAGE) {
-            RmPageHandle prev_ph = fetch_page_handle(prev);
+            WritePageGuard prev_guard = fetch_page_write(prev);
+            RmPageHandle prev_ph(&file_hdr_, prev_guard.get_page());
             if (prev_ph.page_hdr->next_free_page_no == page_no) {
                 prev_ph.page_hdr->next_free_page_no = ph.page_hdr->next_free_page_no;
-                buffer_pool_manager_->unpin_page(prev_ph.page->get_page_id(), true);
                 break;
             }
-            int next = prev_ph.page_hdr->next_free_page_no;
-            buffer_pool_manager_->unpin_page(prev_ph.page->get_page_id(), false);
-            prev = next;
+            prev = prev_ph.page_hdr->next_free_page_no;
         }
     }
     ph.page_hdr->next_free_page_no = RM_NO_PAGE;
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <memory>
 #include <string> // 必需
+#include <vector>
 
 #include "bitmap.h"
 #include "common/context.h"
@@ -33,6 +34,8 @@ struct RmPageHandle {
 /* 文件句柄类 */
 class RmFileHandle {
     friend class RmScan;
+    friend class RmBatchScan;
+    friend class RmReadahead;
     friend class RmManager;
 
    private:
@@ -55,20 +58,27 @@ class RmFileHandle {
     int GetFd() { return fd_; }
 
     bool is_record(const Rid &rid) const {
-        RmPageHandle page_handle = fetch_page_handle(rid.page_no);
+        ReadPageGuard guard = fetch_page_read(rid.page_no);
+        RmPageHandle page_handle(&file_hdr_, guard.get_page());
         return Bitmap::is_set(page_handle.bitmap, rid.slot_no);
     }
 
     std::unique_ptr<RmRecord> get_record(const Rid &rid, Context *context) const;
+    RecordView get_record_view(const Rid &rid, Context *context) const;
     Rid insert_record(char *buf, Context *context);
+    void insert_records(const char *buf, int num_records, std::vector<Rid> *rids, Context *context);
     void insert_record(const Rid &rid, char *buf);
     void delete_record(const Rid &rid, Context *context);
     void update_record(const Rid &rid, char *buf, Context *context);
 
     RmPageHandle create_new_page_handle();
-    RmPageHandle fetch_page_handle(int page_no) const;
+    RmPageHandle fetch_page_handle(int page_no, BufferAccessStrategy *strategy = nullptr) const;
+
+    ReadPageGuard fetch_page_read(int page_no, BufferAccessStrategy *strategy = nullptr) const;
+
+    WritePageGuard fetch_page_write(int page_no) const;
 
    private:
-    RmPageHandle create_page_handle();
+    WritePageGuard create_page_guard();
     void release_page_handle(RmPageHandle &page_handle);
 };
\ No newline at end of file
@@ -1,7 +1,36 @@
 #include "rm_scan.h"
+
+#include <algorithm>
+#include <cassert>
+
 #include "rm_file_handle.h"
 
-RmScan::RmScan(const RmFileHandle *fh) : file_handle_(fh) {
+RmReadahead::RmReadahead(const RmFileHandle *fh)
+    : file_handle_(fh), window_(fh->buffer_pool_manager_->get_scan_readahead()) {
+    // 超过缓冲池一定比例的表使用私有的环形缓冲区扫描，不与其他事务争抢整个缓冲池
+    if (static_cast<size_t>(file_handle_->file_hdr_.num_pages) >
+        file_handle_->buffer_pool_manager_->get_pool_size() / BULK_READ_SCAN_THRESHOLD) {
+        strategy_ = std::make_shared<BufferAccessStrategy>(BufferAccessType::BULK_READ);
+    }
+}
+
+/**
+ * @description: 扫描到达已预读范围的后一半时，异步预读接下来的一个窗口，使磁盘读取与扫描重叠
+ * @param {int} page_no 即将访问的页面
+ */
+void RmReadahead::readahead(int page_no) {
+    if (window_ <= 0 || page_no + window_ / 2 < prefetch_end_) {
+        return;
+    }
+    int start = std::max(page_no, prefetch_end_);
+    int end = std::min(page_no + window_, file_handle_->file_hdr_.num_pages);
+    if (start < end) {
+        file_handle_->buffer_pool_manager_->prefetch_pages({file_handle_->fd_, start}, end - start, strategy_);
+        prefetch_end_ = end;
+    }
+}
+
+RmScan::RmScan(const RmFileHandle *fh) : file_handle_(fh), readahead_(fh) {
     rid_.page_no = RM_NO_PAGE;
     rid_.slot_no = -1;
     next();                                        // 定位到第一条记录
@@ -12,10 +41,16 @@ void RmScan::next() {
     int slot = rid_.slot_no;
 
     while (page < file_handle_->file_hdr_.num_pages) {
-        RmPageHandle ph = file_handle_->fetch_page_handle(page);
-        int next_slot = Bitmap::next_bit(true, ph.bitmap,
-                                         file_handle_->file_hdr_.num_records_per_page, slot);
-        file_handle_->buffer_pool_manager_->unpin_page(ph.page->get_page_id(), false);
+        readahead_.readahead(page);
+        int next_slot;
+        {
+            ReadPageGuard guard = file_handle_->fetch_page_read(page, readahead_.strategy());
+            RmPageHandle ph(&file_handle_->file_hdr_, guard.get_page());
+            // 空页面不必查找位图
+            next_slot = ph.page_hdr->num_records == 0
+                            ? file_handle_->file_hdr_.num_records_per_page
+                            : Bitmap::next_bit(true, ph.bitmap, file_handle_->file_hdr_.num_records_per_page, slot);
+        }
 
         if (next_slot < file_handle_->file_hdr_.num_records_per_page) {
             rid_.page_no = page;
@@ -35,4 +70,43 @@ bool RmScan::is_end() const {
 
 Rid RmScan::rid() const {
     return rid_;
-}
\ No newline at end of file
+}
+
+RmBatchScan::RmBatchScan(const RmFileHandle *fh) : file_handle_(fh), readahead_(fh) {}
+
+bool RmBatchScan::next_batch(RmPageBatch *batch) {
+    batch->release();
+    const int num_records_per_page = file_handle_->file_hdr_.num_records_per_page;
+    for (; page_ < file_handle_->file_hdr_.num_pages; ++page_) {
+        readahead_.readahead(page_);
+        ReadPageGuard guard = file_handle_->fetch_page_read(page_, readahead_.strategy());
+        RmPageHandle ph(&file_handle_->file_hdr_, guard.get_page());
+        const int num_records = ph.page_hdr->num_records;
+        // 空页面和满页面的快速路径只看页头的记录数，它必须与位图一致
+        assert(Bitmap::count(ph.bitmap, num_records_per_page) == num_records);
+        if (num_records == 0) {
+            continue;
+        }
+        if (num_records == num_records_per_page) {
+            // 满页面的所有槽都有记录，不必查找位图
+            for (int slot = 0; slot < num_records_per_page; slot++) {
+                batch->slot_nos_.push_back(slot);
+            }
+        } else {
+            batch->slot_nos_.reserve(num_records);
+            for (int slot = Bitmap::first_bit(true, ph.bitmap, num_records_per_page); slot < num_records_per_page;
+                 slot = Bitmap::next_bit(true, ph.bitmap, num_records_per_page, slot)) {
+                batch->slot_nos_.push_back(slot);
+            }
+        }
+        if (!batch->slot_nos_.empty()) {
+            batch->page_no_ = page_++;
+            batch->slots_ = ph.slots;
+            batch->record_size_ = file_handle_->file_hdr_.record_size;
+            // 位图和页头已经读完，批次只保留pin，不在两次next_batch之间持有页面锁
+            batch->guard_ = std::make_shared<PageGuard>(guard.unlatch());
+            return true;
+        }
+    }
+    return false;
+}
@@ -10,13 +10,71 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "rm_defs.h"
 
 class RmFileHandle;
 
+/**
+ * @description: 批量扫描得到的一个页面：只持有页面的pin，列出页面上所有记录的槽号。
+ * record返回的指针直接指向缓冲池的帧，在release或下一次next_batch之前有效；
+ * view返回的视图与批次共享页面的pin，在视图释放之前一直有效。
+ * 批次不持有页面锁，记录的内容由扫描持有的表锁保证不被修改；需要在页面锁下读取时用ScopedReadLatch(page())
+ */
+class RmPageBatch {
+    friend class RmBatchScan;
+
+    std::shared_ptr<PageGuard> guard_;
+    int page_no_ = RM_NO_PAGE;
+    const char *slots_ = nullptr;   // 页面中第0个槽的起始地址
+    int record_size_ = 0;
+    std::vector<int> slot_nos_;     // 页面上有记录的槽号，升序排列
+public:
+    size_t size() const { return slot_nos_.size(); }
+
+    bool empty() const { return slot_nos_.empty(); }
+
+    Page *page() const { return guard_ ? guard_->get_page() : nullptr; }
+
+    Rid rid(size_t i) const { return Rid{page_no_, slot_nos_[i]}; }
+
+    const char *record(size_t i) const { return slots_ + slot_nos_[i] * record_size_; }
+
+    RecordView view(size_t i) const { return RecordView(record(i), record_size_, guard_); }
+
+    /**
+     * @description: 释放批次对页面的引用，之后批次为空。页面在所有视图释放后才被unpin
+     */
+    void release() {
+        guard_.reset();
+        page_no_ = RM_NO_PAGE;
+        slots_ = nullptr;
+        slot_nos_.clear();
+    }
+};
+
+/**
+ * @description: 顺序扫描的预读：按缓冲池的预读窗口异步预读即将访问的页面，大表使用私有的环形缓冲区
+ */
+class RmReadahead {
+    const RmFileHandle *file_handle_;
+    std::shared_ptr<BufferAccessStrategy> strategy_;    // 扫描大表时使用的环形缓冲区，小表为nullptr
+    int window_;                // 预读窗口的页面个数，为0时不预读
+    int prefetch_end_ = 0;      // 已经发出预读请求的页面范围的末尾
+public:
+    explicit RmReadahead(const RmFileHandle *file_handle);
+
+    BufferAccessStrategy *strategy() const { return strategy_.get(); }
+
+    void readahead(int page_no);
+};
+
 class RmScan : public RecScan {
     const RmFileHandle *file_handle_;
     Rid rid_;
+    RmReadahead readahead_;
 public:
     RmScan(const RmFileHandle *file_handle);
 
@@ -26,3 +84,21 @@ public:
 
     Rid rid() const override;
 };
+
+/**
+ * @description: 以页面为单位的顺序扫描，每个页面只访问一次缓冲池。构造时不访问页面，第一次next_batch时才定位到第一个页面
+ */
+class RmBatchScan {
+    const RmFileHandle *file_handle_;
+    RmReadahead readahead_;
+    int page_ = RM_FIRST_RECORD_PAGE;  // 下一次next_batch开始查找的页面
+public:
+    explicit RmBatchScan(const RmFileHandle *file_handle);
+
+    /**
+     * @description: 释放batch中原来的页面，固定下一个有记录的页面并列出其中所有记录
+     * @return {bool} 是否还有页面，为false时batch为空
+     * @param {RmPageBatch*} batch 存放结果，可以在多次调用之间重用
+     */
+    bool next_batch(RmPageBatch *batch);
+};
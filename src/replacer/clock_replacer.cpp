@@ -0,0 +1,96 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "clock_replacer.h"
+
+ClockReplacer::ClockReplacer(size_t num_pages) : states_(new std::atomic<uint8_t>[num_pages]), max_size_(num_pages) {
+    for (size_t i = 0; i < max_size_; ++i) {
+        states_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ClockReplacer::~ClockReplacer() = default;
+
+/**
+ * @brief 转动时钟指针，清除沿途帧的reference bit，淘汰第一个reference bit为0的可替换帧
+ * @param[out] frame_id id of victim frame
+ * @return true if a victim frame was found, false otherwise
+ */
+bool ClockReplacer::victim(frame_id_t *frame_id) {
+    std::scoped_lock lock{latch_};
+    // 每个帧最多被访问两次：第一次清除reference bit，第二次被淘汰
+    for (size_t i = 0; i < 2 * max_size_ + 1 && size_.load() > 0; ++i) {
+        size_t fid = hand_;
+        hand_ = (hand_ + 1) % max_size_;
+        uint8_t state = states_[fid].load();
+        if (!(state & IN_REPLACER)) {
+            continue;
+        }
+        if (state & REFERENCED) {
+            states_[fid].fetch_and(static_cast<uint8_t>(~REFERENCED));
+            continue;
+        }
+        // 并发的pin/unpin可能刚改变了该帧的状态，CAS失败时跳过该帧
+        if (states_[fid].compare_exchange_strong(state, 0)) {
+            size_--;
+            *frame_id = static_cast<frame_id_t>(fid);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 固定一个frame, 表明它不应该成为victim（即在replacer中移除该frame_id）
+ * @param frame_id the id of the frame to pin
+ */
+void ClockReplacer::pin(frame_id_t frame_id) {
+    uint8_t old_state = states_[frame_id].fetch_and(static_cast<uint8_t>(~IN_REPLACER));
+    if (old_state & IN_REPLACER) {
+        size_--;
+    }
+}
+
+/**
+ * @brief 取消固定一个frame, 表明它可以成为victim（即加入replacer），同时置位reference bit
+ * @param frame_id the id of the frame to unpin
+ * @note 已在replacer中的帧保持原状态，不会因此获得第二次机会
+ */
+void ClockReplacer::unpin(frame_id_t frame_id) {
+    uint8_t old_state = states_[frame_id].load();
+    do {
+        if (old_state & IN_REPLACER) {
+            return;
+        }
+    } while (!states_[frame_id].compare_exchange_weak(old_state, old_state | IN_REPLACER | REFERENCED));
+    size_++;
+}
+
+/**
+ * @brief 从时钟指针开始列出接下来会被淘汰的frame：先是reference bit为0的帧，再是其余可替换的帧
+ * @note 只读取状态位，不清除reference bit，因此结果是近似的淘汰顺序
+ */
+void ClockReplacer::victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n) {
+    std::scoped_lock lock{latch_};
+    for (uint8_t referenced : {static_cast<uint8_t>(0), REFERENCED}) {
+        for (size_t i = 0; i < max_size_ && frame_ids->size() < n; ++i) {
+            size_t fid = (hand_ + i) % max_size_;
+            uint8_t state = states_[fid].load();
+            if ((state & IN_REPLACER) && (state & REFERENCED) == referenced) {
+                frame_ids->push_back(static_cast<frame_id_t>(fid));
+            }
+        }
+    }
+}
+
+/**
+ * @brief 返回当前replacer中可以被替换的帧的数量
+ */
+size_t ClockReplacer::Size() { return size_.load(); }
@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "common/config.h"
+#include "replacer/replacer.h"
+
+/*
+ClockReplacer实现了CLOCK（second-chance）替换策略
+每个帧在一个扁平数组中占一个字节的状态，pin/unpin只做一次原子位运算，不分配内存也不加锁，
+只有victim需要持有latch_来移动时钟指针
+*/
+class ClockReplacer : public Replacer {
+   public:
+    /**
+     * @description: 创建一个新的ClockReplacer
+     * @param {size_t} num_pages ClockReplacer最多需要存储的page数量
+     */
+    explicit ClockReplacer(size_t num_pages);
+
+    ~ClockReplacer();
+
+    bool victim(frame_id_t *frame_id);
+
+    void pin(frame_id_t frame_id);
+
+    void unpin(frame_id_t frame_id);
+
+    void victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n);
+
+    size_t Size();
+
+   private:
+    static constexpr uint8_t IN_REPLACER = 0x1;     // 帧可以被替换
+    static constexpr uint8_t REFERENCED = 0x2;      // 帧最近被访问过（reference bit）
+
+    std::mutex latch_;                          // 保护时钟指针hand_
+    std::unique_ptr<std::atomic<uint8_t>[]> states_;    // 每个帧的状态位
+    std::atomic<size_t> size_{0};               // 可被替换的帧的个数
+    size_t hand_ = 0;                           // 时钟指针
+    size_t max_size_;                           // 最大容量（与缓冲池的容量相同）
+};
@@ -0,0 +1,122 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "lru_k_replacer.h"
+
+#include <algorithm>
+
+LRUKReplacer::LRUKReplacer(size_t num_pages, size_t k, size_t correlated_period)
+    : frames_(num_pages), k_(std::max<size_t>(k, 1)), correlated_period_(correlated_period), max_size_(num_pages) {}
+
+LRUKReplacer::~LRUKReplacer() = default;
+
+/**
+ * @brief 计算帧的淘汰顺序，调用者需持有latch_
+ * @note 访问次数不足K次的帧按最近一次访问时间排序，其余帧按倒数第K次访问时间排序
+ */
+LRUKReplacer::EvictKey LRUKReplacer::make_key(frame_id_t frame_id) const {
+    const auto &history = frames_[frame_id].history;
+    if (history.size() < k_) {
+        return {false, history.empty() ? 0 : history.back(), frame_id};
+    }
+    return {true, history.front(), frame_id};
+}
+
+/**
+ * @brief 使用LRU-K策略删除一个victim frame，这个函数能得到frame_id
+ * @param[out] frame_id id of victim frame
+ * @return true if a victim frame was found, false otherwise
+ */
+bool LRUKReplacer::victim(frame_id_t *frame_id) {
+    std::scoped_lock lock{latch_};
+    if (evictable_.empty()) {
+        return false;
+    }
+    *frame_id = std::get<2>(*evictable_.begin());
+    evictable_.erase(evictable_.begin());
+    frames_[*frame_id].evictable = false;
+    return true;
+}
+
+/**
+ * @brief 固定一个frame, 表明它不应该成为victim（即在replacer中移除该frame_id）
+ * @param frame_id the id of the frame to pin
+ */
+void LRUKReplacer::pin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    auto &frame = frames_[frame_id];
+    if (frame.evictable) {
+        evictable_.erase(frame.key);
+        frame.evictable = false;
+    }
+}
+
+/**
+ * @brief 取消固定一个frame, 表明它可以成为victim（即加入replacer）
+ * @param frame_id the id of the frame to unpin
+ */
+void LRUKReplacer::unpin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    auto &frame = frames_[frame_id];
+    if (frame.evictable || evictable_.size() >= max_size_) {
+        return;
+    }
+    frame.key = make_key(frame_id);
+    evictable_.insert(frame.key);
+    frame.evictable = true;
+}
+
+/**
+ * @brief 记录一次对帧的访问
+ * @param frame_id the id of the accessed frame
+ * @param is_new_page 帧中刚装入了新页面，丢弃之前页面的访问历史
+ */
+void LRUKReplacer::record_access(frame_id_t frame_id, bool is_new_page) {
+    std::scoped_lock lock{latch_};
+    auto &frame = frames_[frame_id];
+    auto &history = frame.history;
+    uint64_t now = ++current_timestamp_;
+    if (is_new_page) {
+        history.clear();
+    }
+    if (!history.empty() && now - history.back() <= correlated_period_) {
+        // 相关访问只推迟最近一次访问的时间，不计入新的访问
+        history.back() = now;
+    } else {
+        history.push_back(now);
+        if (history.size() > k_) {
+            history.erase(history.begin());
+        }
+    }
+    // 访问通常发生在pin之后，若帧仍可被淘汰则需更新其位置
+    if (frame.evictable) {
+        evictable_.erase(frame.key);
+        frame.key = make_key(frame_id);
+        evictable_.insert(frame.key);
+    }
+}
+
+/**
+ * @brief 按淘汰顺序列出接下来会被淘汰的frame
+ */
+void LRUKReplacer::victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n) {
+    std::scoped_lock lock{latch_};
+    for (auto it = evictable_.begin(); it != evictable_.end() && frame_ids->size() < n; ++it) {
+        frame_ids->push_back(std::get<2>(*it));
+    }
+}
+
+/**
+ * @brief 返回当前replacer中可以被替换的帧的数量
+ */
+size_t LRUKReplacer::Size() {
+    std::scoped_lock lock{latch_};
+    return evictable_.size();
+}
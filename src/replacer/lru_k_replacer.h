@@ -0,0 +1,71 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "common/config.h"
+#include "replacer/replacer.h"
+
+/*
+LRUKReplacer实现了LRU-K替换策略
+每个帧记录最近K次访问的逻辑时间，淘汰backward k-distance（当前时间与倒数第K次访问时间之差）最大的帧。
+访问次数不足K次的帧k-distance视为无穷大，优先被淘汰，它们之间按最近一次访问时间做LRU。
+因此顺序扫描只访问一次的页面会先于被反复访问的热点页面（如B+树内部结点）被淘汰。
+间隔不超过correlated_period的连续访问（例如扫描时对同一页面逐条读取记录）只算作一次访问。
+*/
+class LRUKReplacer : public Replacer {
+   public:
+    /**
+     * @description: 创建一个新的LRUKReplacer
+     * @param {size_t} num_pages LRUKReplacer最多需要存储的page数量
+     * @param {size_t} k 计算k-distance时使用的访问次数
+     * @param {size_t} correlated_period 相关访问的时间窗口，以访问次数计
+     */
+    explicit LRUKReplacer(size_t num_pages, size_t k = LRUK_K, size_t correlated_period = LRUK_CORRELATED_PERIOD);
+
+    ~LRUKReplacer();
+
+    bool victim(frame_id_t *frame_id);
+
+    void pin(frame_id_t frame_id);
+
+    void unpin(frame_id_t frame_id);
+
+    void victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n);
+
+    void record_access(frame_id_t frame_id, bool is_new_page = false);
+
+    size_t Size();
+
+   private:
+    // 淘汰顺序：(访问次数是否已达到K次, 比较用的访问时间, 帧号)，越小越先被淘汰
+    using EvictKey = std::tuple<bool, uint64_t, frame_id_t>;
+
+    struct FrameInfo {
+        std::vector<uint64_t> history;  // 最近K次访问的逻辑时间，从旧到新
+        bool evictable = false;         // 是否在evictable_中
+        EvictKey key;                   // 加入evictable_时使用的key
+    };
+
+    EvictKey make_key(frame_id_t frame_id) const;
+
+    std::mutex latch_;                  // 互斥锁
+    std::vector<FrameInfo> frames_;     // 每个帧的访问历史
+    std::set<EvictKey> evictable_;      // 可以被淘汰的帧，按淘汰顺序排列
+    uint64_t current_timestamp_ = 0;    // 逻辑时钟，每次访问加一
+    size_t k_;
+    size_t correlated_period_;
+    size_t max_size_;   // 最大容量（与缓冲池的容量相同）
+};
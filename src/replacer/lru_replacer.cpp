@@ -63,6 +63,16 @@ void LRUReplacer::unpin(frame_id_t frame_id) {
     LRUhash_[frame_id] = LRUlist_.begin();
 }
 
+/**
+ * @brief 按淘汰顺序（从链表尾部开始）列出接下来会被淘汰的frame
+ */
+void LRUReplacer::victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n) {
+    std::scoped_lock lock{latch_};
+    for (auto it = LRUlist_.rbegin(); it != LRUlist_.rend() && frame_ids->size() < n; ++it) {
+        frame_ids->push_back(*it);
+    }
+}
+
 /**
  * @brief 两个函数返回当前replacer中元素的数量
  */
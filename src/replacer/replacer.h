@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <vector>
+
 #include "common/config.h"
 
 /**
@@ -39,6 +41,23 @@ class Replacer {
      */
     virtual void unpin(frame_id_t frame_id) = 0;
 
+    /**
+     * Records that the page held by a frame has been accessed. Policies that only depend on
+     * pin/unpin order (LRU, CLOCK) ignore it.
+     * @param frame_id the id of the accessed frame
+     * @param is_new_page true if a different page has just been loaded into the frame,
+     *                    so the access history of the frame should be discarded
+     */
+    virtual void record_access(frame_id_t frame_id, bool is_new_page = false) {}
+
+    /**
+     * Lists the frames that would be victimized next, in order, without removing them.
+     * Used by the page cleaner to write back dirty pages before they are evicted.
+     * @param[out] frame_ids the candidate frames
+     * @param n the maximum number of candidates
+     */
+    virtual void victim_candidates(std::vector<frame_id_t> *frame_ids, size_t n) = 0;
+
     /** @return the number of elements in the replacer that can be victimized */
     virtual size_t Size() = 0;
 };
@@ -0,0 +1,300 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "async_io.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "errors.h"
+#include "storage/disk_manager.h"
+
+size_t AsyncIOEngine::execute(std::vector<IORequest> &requests) {
+    auto start = std::chrono::steady_clock::now();
+    for (auto &request : requests) {
+        // 绕过DiskManager直接写fd，同样需要让该文件不再提供mmap映射
+        if (request.is_write && fd_owner_ != nullptr) fd_owner_->mark_written(request.fd);
+        submit(&request);
+    }
+    std::vector<IORequest *> completed;
+    while (inflight_ > 0) {
+        size_t reaped = completed.size();
+        // 逐批收割，使统计中的延迟接近每个请求从提交到完成的时间
+        reap(&completed, fd_owner_ != nullptr ? 1 : inflight_);
+        if (fd_owner_ == nullptr) continue;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        uint64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        for (size_t i = reaped; i < completed.size(); i++) {
+            IORequest *request = completed[i];
+            if (request->result <= 0) continue;
+            fd_owner_->record_io(request->fd, request->is_write ? FileIOStats::WRITE : FileIOStats::READ,
+                                 request->result, latency_us);
+        }
+    }
+    return std::count_if(requests.begin(), requests.end(), [](const IORequest &request) { return !request.ok(); });
+}
+
+std::unique_ptr<AsyncIOEngine> AsyncIOEngine::create(unsigned queue_depth, const std::string &type,
+                                                     DiskManager *disk_manager) {
+    if (disk_manager != nullptr && !disk_manager->is_native()) {
+        return std::make_unique<ThreadPoolIOEngine>(queue_depth, ASYNC_IO_THREADS, disk_manager);
+    }
+    std::unique_ptr<AsyncIOEngine> engine;
+    if (type != "THREADS") {
+        try {
+            engine = std::make_unique<IoUringEngine>(queue_depth);
+        } catch (UnixError &) {
+            // 内核不支持io_uring或被seccomp等禁用
+            if (type == "URING") throw;
+        }
+    }
+    if (engine == nullptr) engine = std::make_unique<ThreadPoolIOEngine>(queue_depth);
+    engine->fd_owner_ = disk_manager;
+    return engine;
+}
+
+/**
+ * @description: 完整地读写一个请求，处理读写字节数不足的情况，供线程池使用
+ */
+static int do_sync_io(const IORequest &request) {
+    off_t pos = static_cast<off_t>(request.page_no) * PAGE_SIZE;
+    int done = 0;
+    while (done < request.num_bytes) {
+        ssize_t n = request.is_write ? pwrite(request.fd, request.buf + done, request.num_bytes - done, pos + done)
+                                     : pread(request.fd, request.buf + done, request.num_bytes - done, pos + done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break;  // 读到文件末尾
+        done += n;
+    }
+    return done;
+}
+
+/**
+ * @description: 通过DiskManager完成一个请求，出错时返回-EIO
+ */
+static int do_disk_manager_io(DiskManager *disk_manager, const IORequest &request) {
+    try {
+        if (request.is_write) {
+            disk_manager->write_page(request.fd, request.page_no, request.buf, request.num_bytes);
+        } else {
+            disk_manager->read_page(request.fd, request.page_no, request.buf, request.num_bytes);
+        }
+    } catch (std::exception &) {
+        return -EIO;
+    }
+    return request.num_bytes;
+}
+
+/* ------------------------------------------------------------------ io_uring */
+
+// 共享环上由内核和用户态同时访问的下标需要使用acquire/release语义
+static unsigned load_acquire(const unsigned *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+static void store_release(unsigned *p, unsigned v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+IoUringEngine::IoUringEngine(unsigned queue_depth) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, std::max(queue_depth, 1u), &params));
+    if (ring_fd_ < 0) {
+        throw UnixError();
+    }
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                    IORING_OFF_SQ_RING);
+    cq_ring_ = single_mmap ? sq_ring_
+                           : mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                  ring_fd_, IORING_OFF_CQ_RING);
+    sqes_ = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED || sqes_ == MAP_FAILED) {
+        int err = errno;
+        if (sq_ring_ != MAP_FAILED) munmap(sq_ring_, sq_ring_size_);
+        if (!single_mmap && cq_ring_ != MAP_FAILED) munmap(cq_ring_, cq_ring_size_);
+        if (sqes_ != MAP_FAILED) munmap(sqes_, sqes_size_);
+        close(ring_fd_);
+        errno = err;
+        throw UnixError();
+    }
+
+    char *sq = static_cast<char *>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    char *cq = static_cast<char *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = cq + params.cq_off.cqes;
+}
+
+IoUringEngine::~IoUringEngine() {
+    // 等待正在进行的请求完成，避免内核在请求的缓冲区被释放后继续写入
+    std::vector<IORequest *> completed;
+    while (inflight_ > 0) {
+        try {
+            reap(&completed, inflight_);
+        } catch (...) {
+            break;
+        }
+    }
+    munmap(sqes_, sqes_size_);
+    if (cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+    munmap(sq_ring_, sq_ring_size_);
+    close(ring_fd_);
+}
+
+/**
+ * @description: 将SQ中的请求交给内核，并等待至少min_complete个请求完成
+ */
+void IoUringEngine::enter(unsigned min_complete) {
+    while (true) {
+        int ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, to_submit_, min_complete,
+                                           min_complete > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+        if (ret >= 0) {
+            to_submit_ -= std::min<unsigned>(to_submit_, ret);
+            if (to_submit_ == 0) return;
+            continue;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            throw UnixError();
+        }
+    }
+}
+
+/**
+ * @description: 取出CQ中所有已完成的请求
+ */
+size_t IoUringEngine::drain_cq(std::vector<IORequest *> *completed) {
+    unsigned head = *cq_head_;
+    unsigned tail = load_acquire(cq_tail_);
+    size_t count = 0;
+    auto *cqes = static_cast<struct io_uring_cqe *>(cqes_);
+    while (head != tail) {
+        struct io_uring_cqe *cqe = &cqes[head & *cq_mask_];
+        auto *request = reinterpret_cast<IORequest *>(cqe->user_data);
+        request->result = cqe->res;
+        completed->push_back(request);
+        head++;
+        count++;
+    }
+    store_release(cq_head_, head);
+    inflight_ -= count;
+    return count;
+}
+
+void IoUringEngine::submit(IORequest *request) {
+    // 正在进行的请求不超过SQ的大小，保证CQ不会溢出
+    while (inflight_ - ready_.size() >= sq_entries_) {
+        enter(1);
+        size_t n = drain_cq(&ready_);
+        inflight_ += n;  // ready_中的请求在被reap取走之前仍计入inflight_
+    }
+    unsigned tail = *sq_tail_;
+    unsigned idx = tail & *sq_mask_;
+    auto *sqe = static_cast<struct io_uring_sqe *>(sqes_) + idx;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = request->is_write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = request->fd;
+    sqe->off = static_cast<uint64_t>(request->page_no) * PAGE_SIZE;
+    sqe->addr = reinterpret_cast<uint64_t>(request->buf);
+    sqe->len = request->num_bytes;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    sq_array_[idx] = idx;
+    store_release(sq_tail_, tail + 1);
+    to_submit_++;
+    inflight_++;
+}
+
+size_t IoUringEngine::reap(std::vector<IORequest *> *completed, size_t min_complete) {
+    min_complete = std::min(min_complete, inflight_);
+    size_t count = ready_.size();
+    completed->insert(completed->end(), ready_.begin(), ready_.end());
+    inflight_ -= ready_.size();
+    ready_.clear();
+    count += drain_cq(completed);
+    if (count < min_complete || to_submit_ > 0) {
+        enter(static_cast<unsigned>(min_complete > count ? min_complete - count : 0));
+        count += drain_cq(completed);
+    }
+    return count;
+}
+
+/* ------------------------------------------------------------------ thread pool */
+
+ThreadPoolIOEngine::ThreadPoolIOEngine(unsigned queue_depth, unsigned num_threads, DiskManager *disk_manager)
+    : queue_depth_(std::max(queue_depth, 1u)), disk_manager_(disk_manager) {
+    for (unsigned i = 0; i < std::max(num_threads, 1u); i++) {
+        workers_.emplace_back([this] {
+            std::unique_lock lock{latch_};
+            while (true) {
+                submit_cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+                if (pending_.empty()) return;
+                IORequest *request = pending_.front();
+                pending_.pop_front();
+                lock.unlock();
+                request->result = disk_manager_ != nullptr ? do_disk_manager_io(disk_manager_, *request)
+                                                           : do_sync_io(*request);
+                lock.lock();
+                done_.push_back(request);
+                complete_cv_.notify_one();
+            }
+        });
+    }
+}
+
+ThreadPoolIOEngine::~ThreadPoolIOEngine() {
+    {
+        std::scoped_lock lock{latch_};
+        stop_ = true;
+    }
+    submit_cv_.notify_all();
+    // 工作线程会先处理完队列中剩余的请求
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPoolIOEngine::submit(IORequest *request) {
+    std::unique_lock lock{latch_};
+    // 超过队列深度时等待，已完成但未被reap取走的请求不占用队列
+    complete_cv_.wait(lock, [this] { return inflight_ - done_.size() < queue_depth_; });
+    pending_.push_back(request);
+    inflight_++;
+    submit_cv_.notify_one();
+}
+
+size_t ThreadPoolIOEngine::reap(std::vector<IORequest *> *completed, size_t min_complete) {
+    std::unique_lock lock{latch_};
+    min_complete = std::min(min_complete, inflight_);
+    complete_cv_.wait(lock, [&] { return done_.size() >= min_complete; });
+    size_t count = done_.size();
+    completed->insert(completed->end(), done_.begin(), done_.end());
+    done_.clear();
+    inflight_ -= count;
+    return count;
+}
@@ -0,0 +1,166 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+
+class DiskManager;
+
+/**
+ * @description: 一个异步页面读写请求。请求在提交后到完成之前不能被释放或修改
+ */
+struct IORequest {
+    bool is_write = false;
+    int fd = -1;
+    page_id_t page_no = INVALID_PAGE_ID;
+    char *buf = nullptr;        // 以O_DIRECT打开的文件要求buf按PAGE_SIZE对齐（缓冲池的帧满足该要求）
+    int num_bytes = PAGE_SIZE;
+    int result = 0;             // 完成后为读写的字节数，失败时为-errno
+    void *user_data = nullptr;  // 调用者自定义的数据
+
+    bool ok() const { return result == num_bytes; }
+};
+
+/**
+ * @description: 异步批量磁盘I/O引擎，允许一个线程同时有多个I/O在进行。
+ * 优先使用io_uring，内核不支持（或被禁用）时退回线程池。一个引擎对象同一时刻只能由一个线程使用
+ */
+class AsyncIOEngine {
+   public:
+    virtual ~AsyncIOEngine() = default;
+
+    /**
+     * @description: 提交一个请求，正在进行的请求达到队列深度时会先等待一部分请求完成
+     * @param {IORequest*} request 请求，完成之前由调用者保证有效
+     */
+    virtual void submit(IORequest *request) = 0;
+
+    /**
+     * @description: 等待请求完成
+     * @return {size_t} 传出的完成请求个数
+     * @param {vector<IORequest*>*} completed 追加完成的请求
+     * @param {size_t} min_complete 至少等待完成的个数，不超过正在进行的请求个数
+     */
+    virtual size_t reap(std::vector<IORequest *> *completed, size_t min_complete) = 0;
+
+    /**
+     * @description: 已提交尚未被reap取走的请求个数
+     */
+    size_t get_inflight() const { return inflight_; }
+
+    virtual const char *get_name() const = 0;
+
+    /**
+     * @description: 提交一批请求并等待全部完成
+     * @return {size_t} 失败（包括读写字节数不足）的请求个数，失败原因见各请求的result
+     */
+    size_t execute(std::vector<IORequest> &requests);
+
+    /**
+     * @description: 创建引擎。type为"URING"或"THREADS"时使用指定的实现，为空时优先使用io_uring。
+     * disk_manager的页面数据不在fd对应的文件中（如内存后端）时，总是使用通过disk_manager读写的线程池
+     * @param {unsigned} queue_depth 同时进行的I/O个数上限
+     * @param {string&} type 默认由环境变量RMDB_IO_ENGINE指定
+     * @param {DiskManager*} disk_manager 请求中的fd所属的DiskManager，为nullptr时直接读写fd；
+     * 引擎直接读写fd时，execute写过的文件在disk_manager中标记为已写，完成的请求计入disk_manager的I/O统计
+     */
+    static std::unique_ptr<AsyncIOEngine> create(unsigned queue_depth = ASYNC_IO_QUEUE_DEPTH,
+                                                 const std::string &type = get_config("IO_ENGINE", ""),
+                                                 DiskManager *disk_manager = nullptr);
+
+   protected:
+    size_t inflight_ = 0;
+    DiskManager *fd_owner_ = nullptr;  // 直接读写fd的引擎在execute中向它登记写过的文件，并把完成的请求计入它的I/O统计
+};
+
+/**
+ * @description: 基于io_uring的引擎，直接使用io_uring_setup/io_uring_enter系统调用，不依赖liburing
+ */
+class IoUringEngine : public AsyncIOEngine {
+   public:
+    /**
+     * @description: 创建io_uring，失败时抛出UnixError
+     */
+    explicit IoUringEngine(unsigned queue_depth);
+
+    ~IoUringEngine() override;
+
+    void submit(IORequest *request) override;
+
+    size_t reap(std::vector<IORequest *> *completed, size_t min_complete) override;
+
+    const char *get_name() const override { return "io_uring"; }
+
+   private:
+    void enter(unsigned min_complete);
+
+    size_t drain_cq(std::vector<IORequest *> *completed);
+
+    int ring_fd_ = -1;
+    unsigned sq_entries_ = 0;
+    unsigned to_submit_ = 0;                // 已放入SQ但还未通知内核的请求个数
+    std::vector<IORequest *> ready_;        // submit时为腾出队列而提前收割的完成请求
+
+    void *sq_ring_ = nullptr;
+    void *cq_ring_ = nullptr;
+    void *sqes_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    size_t sqes_size_ = 0;
+
+    unsigned *sq_tail_ = nullptr;
+    unsigned *sq_mask_ = nullptr;
+    unsigned *sq_array_ = nullptr;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned *cq_mask_ = nullptr;
+    void *cqes_ = nullptr;
+};
+
+/**
+ * @description: 线程池实现，由若干工作线程执行同步的pread/pwrite，或者调用DiskManager的同步读写
+ */
+class ThreadPoolIOEngine : public AsyncIOEngine {
+   public:
+    /**
+     * @param {unsigned} queue_depth 同时进行的I/O个数上限
+     * @param {unsigned} num_threads 工作线程个数
+     * @param {DiskManager*} disk_manager 不为nullptr时通过disk_manager读写页面
+     */
+    ThreadPoolIOEngine(unsigned queue_depth, unsigned num_threads = ASYNC_IO_THREADS,
+                       DiskManager *disk_manager = nullptr);
+
+    ~ThreadPoolIOEngine() override;
+
+    void submit(IORequest *request) override;
+
+    size_t reap(std::vector<IORequest *> *completed, size_t min_complete) override;
+
+    const char *get_name() const override { return "threads"; }
+
+   private:
+    unsigned queue_depth_;
+    DiskManager *disk_manager_;
+    std::vector<std::thread> workers_;
+    std::mutex latch_;
+    std::condition_variable submit_cv_;     // 通知工作线程有新请求
+    std::condition_variable complete_cv_;   // 通知调用者有请求完成
+    std::deque<IORequest *> pending_;
+    std::vector<IORequest *> done_;
+    bool stop_ = false;
+};
@@ -0,0 +1,86 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "page.h"
+
+/**
+ * @description: 访问策略的类型
+ * BULK_READ用于大表的顺序扫描，BULK_WRITE用于批量导入
+ */
+enum class BufferAccessType { BULK_READ, BULK_WRITE };
+
+/**
+ * @description: 一个缓冲池分区内的环形缓冲区，记录本次批量访问读入的帧及其装入的页面
+ */
+struct BufferRing {
+    std::vector<std::pair<frame_id_t, PageId>> slots;   // 环中的帧及其装入的页面
+    size_t capacity = 0;    // 环的容量
+    size_t next = 0;        // 下一个被复用的位置
+
+    /**
+     * @description: 将新装入页面的帧放入环中，环满时覆盖next位置
+     */
+    void add(frame_id_t frame_id, const PageId &page_id) {
+        if (slots.size() < capacity) {
+            slots.emplace_back(frame_id, page_id);
+        } else {
+            slots[next] = {frame_id, page_id};
+            next = (next + 1) % capacity;
+        }
+    }
+};
+
+/**
+ * @description: 批量访问策略。使用该策略的缺页只在一个私有的小环形缓冲区中循环复用帧，
+ * 而不从共享的空闲链表或replacer中获取帧，避免大表扫描冲掉其他事务的热点页面。
+ * 缓冲池分区之间互相独立，因此每个分区各有一个子环。
+ * 同一个策略对象只能由一个线程使用。
+ */
+class BufferAccessStrategy {
+    friend class BufferPoolManager;
+
+   public:
+    /**
+     * @param {BufferAccessType} type 访问类型，决定环的大小
+     */
+    explicit BufferAccessStrategy(BufferAccessType type)
+        : type_(type), ring_size_(type == BufferAccessType::BULK_READ ? BULK_READ_RING_SIZE : BULK_WRITE_RING_SIZE) {}
+
+    BufferAccessType get_type() const { return type_; }
+
+    size_t get_ring_size() const { return ring_size_; }
+
+   private:
+    /**
+     * @description: 获取分区对应的子环，第一次使用时根据缓冲池大小初始化各个子环
+     * @note 环的总大小不超过缓冲池的1/8，平均分给各个分区
+     */
+    BufferRing *get_ring(size_t instance_idx, size_t num_instances, size_t pool_size) {
+        if (rings_.empty()) {
+            size_t total = std::min(ring_size_, std::max<size_t>(pool_size / 8, 1));
+            rings_.resize(num_instances);
+            for (auto &ring : rings_) {
+                ring.capacity = std::max<size_t>(total / num_instances, 1);
+            }
+        }
+        return &rings_[instance_idx];
+    }
+
+    BufferAccessType type_;
+    size_t ring_size_;                  // 环的总帧数
+    std::vector<BufferRing> rings_;     // 每个缓冲池分区的子环
+};
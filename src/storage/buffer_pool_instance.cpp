@@ -0,0 +1,635 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "buffer_pool_instance.h"
+
+/**
+ * @description: 从空闲链表或replacer中获取一个可用帧，并将其从页表中移除
+ * @return {bool} 缓冲池中所有帧都被pin住时返回false
+ * @param {unique_lock<mutex>&} lock 调用者持有的latch_，写回脏页期间会被暂时释放
+ * @param {frame_id_t*} frame_id 传出可用帧的帧号
+ * @note 脏的victim在latch之外写回，写回期间保持原页面的映射并pin住该帧，
+ * 写回完成后若该帧又被访问并修改，则将其放回replacer并重新挑选victim
+ */
+bool BufferPoolInstance::find_victim_page(std::unique_lock<std::mutex> &lock, frame_id_t* frame_id) {
+    while (true) {
+        // 1. 检查空闲链表
+        if (!free_list_.empty()) {
+            *frame_id = free_list_.front();
+            free_list_.pop_front();
+            return true;
+        }
+        // 2. 检查 Replacer
+        frame_id_t fid;
+        if (!replacer_->victim(&fid)) {
+            return false;
+        }
+        Page* victim = &pages_[fid];
+        if (victim->pin_count_ > 0) {
+            continue;  // 正被后台写线程写回或刚被无锁命中pin住，由其unpin时放回replacer
+        }
+        if (victim->is_dirty_) {
+            victim->pin_count_++;
+            lock.unlock();
+            try {
+                if (write_back(victim)) {
+                    foreground_write_count_.fetch_add(1, std::memory_order_relaxed);
+                }
+            } catch (...) {
+                lock.lock();
+                unpin_frame(fid);
+                throw;
+            }
+            lock.lock();
+            if (--victim->pin_count_ > 0) {
+                continue;  // 写回期间被其他线程pin住，由其unpin时放回replacer
+            }
+            if (victim->is_dirty_) {
+                replacer_->unpin(fid);
+                continue;
+            }
+            replacer_->pin(fid);  // 写回期间被访问过的帧可能已回到replacer中
+        }
+        if (!try_claim_frame(victim)) {
+            continue;  // 被无锁命中抢先pin住
+        }
+        untrack_dirty(victim->id_);
+        page_table_.erase(victim->id_);
+        *frame_id = fid;
+        return true;
+    }
+}
+
+/**
+ * @description: 从环形缓冲区中取出下一个可以复用的帧，并将其从页表中移除
+ * @return {bool} 环尚未填满，或下一个位置的帧已被其他线程使用时返回false
+ * @param {unique_lock<mutex>&} lock 调用者持有的latch_，写回脏页期间会被暂时释放
+ * @param {BufferRing*} ring 本分区的子环
+ * @param {frame_id_t*} frame_id 传出可用帧的帧号
+ * @note 帧中装入的已不是环记录的页面（被其他线程淘汰复用），或正被其他线程pin住时不能复用
+ */
+bool BufferPoolInstance::get_ring_frame(std::unique_lock<std::mutex> &lock, BufferRing *ring, frame_id_t* frame_id) {
+    if (ring->slots.size() < ring->capacity) {
+        return false;
+    }
+    auto [fid, page_id] = ring->slots[ring->next];
+    Page* page = &pages_[fid];
+    frame_id_t mapped_fid;
+    // 预读装入后还没被扫描访问的页面也不能复用
+    if (!page_table_.find(page_id, &mapped_fid) || mapped_fid != fid || page->pin_count_ != 0 || page->io_error_ ||
+        page->prefetched_) {
+        return false;
+    }
+    replacer_->pin(fid);
+    if (page->is_dirty_) {
+        page->pin_count_++;
+        lock.unlock();
+        try {
+            if (write_back(page)) {
+                foreground_write_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+        } catch (...) {
+            lock.lock();
+            unpin_frame(fid);
+            throw;
+        }
+        lock.lock();
+        if (--page->pin_count_ > 0) {
+            return false;  // 写回期间被其他线程pin住，由其unpin时放回replacer
+        }
+        if (page->is_dirty_) {
+            replacer_->unpin(fid);
+            return false;
+        }
+        replacer_->pin(fid);
+    }
+    if (!try_claim_frame(page)) {
+        return false;  // 被无锁命中抢先pin住，由其unpin时放回replacer
+    }
+    untrack_dirty(page_id);
+    page_table_.erase(page_id);
+    *frame_id = fid;
+    return true;
+}
+
+/**
+ * @description: 为缺页获取一个可用帧，指定了环形缓冲区时优先复用环中的帧
+ * @return {bool} 缓冲池中所有帧都被pin住时返回false
+ * @note 取出的帧可能仍指向上一个页面的mmap映射，在此统一恢复为指向帧自身的缓冲区
+ */
+bool BufferPoolInstance::get_frame(std::unique_lock<std::mutex> &lock, BufferRing *ring, frame_id_t* frame_id) {
+    if (!(ring != nullptr && get_ring_frame(lock, ring, frame_id)) && !find_victim_page(lock, frame_id)) {
+        return false;
+    }
+    Page* page = &pages_[*frame_id];
+    page->data_.store(page->frame_, std::memory_order_release);
+    page->mapped_.store(false, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @description: 将帧中的页面写回磁盘，调用者需pin住该帧，且不能持有latch_
+ * @return {bool} 是否进行了写回
+ * @param {Page*} page 需要写回的页面
+ * @param {bool} force 为false时只写回脏页，页面已被其他线程（如后台写线程）写回时直接返回
+ */
+bool BufferPoolInstance::write_back(Page* page, bool force) {
+    std::exception_ptr error;
+    {
+        std::scoped_lock io_lock{page->io_latch_};
+        // 持有页面读锁，避免写出正在被修改的页面
+        std::shared_lock data_lock{page->rwlatch_};
+        if (!force && !page->is_dirty_) {
+            return false;
+        }
+        // 先清除脏标记再写回，写回期间被修改的页面会重新被标记为脏页
+        page->is_dirty_ = false;
+        try {
+            disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->get_data(), PAGE_SIZE);
+            return true;
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    // 写回期间页面可能被当作干净页面移出了脏页集合
+    mark_dirty(page);
+    std::rethrow_exception(error);
+}
+
+/**
+ * @description: 等待帧上正在进行的读入完成
+ * @return {bool} 读入成功返回true，读入失败返回false
+ */
+bool BufferPoolInstance::wait_for_io(Page* page) {
+    if (page->io_in_progress_) {
+        std::scoped_lock io_lock{page->io_latch_};
+    }
+    return !page->io_error_;
+}
+
+/**
+ * @description: 减少帧的pin_count，调用者需持有latch_
+ */
+void BufferPoolInstance::unpin_frame(frame_id_t frame_id) {
+    Page* page = &pages_[frame_id];
+    if (page->io_error_) {
+        // 读入失败的帧已从页表中移除，最后一个使用者负责将其归还空闲链表；
+        // 在此之前仍可能有持有旧查找结果的无锁命中短暂pin住它，因此用CAS判断是否是最后一个使用者
+        if (try_claim_frame(page, 1)) {
+            page->id_.page_no = INVALID_PAGE_ID;
+            free_list_.push_back(frame_id);
+            return;
+        }
+        page->pin_count_--;
+        return;
+    }
+    if (--page->pin_count_ == 0) {
+        replacer_->unpin(frame_id);
+    }
+}
+
+/**
+ * @description: 将未被pin住的帧标记为不含页面（pin_count_置为-1），之后无锁命中不能再pin住它，调用者需持有latch_
+ * @return {bool} 帧的pin_count不等于预期值（被其他线程pin住）时返回false
+ * @param {Page*} page 要取出的帧
+ * @param {int} pin_count 预期的pin_count，调用者自己持有的pin数
+ */
+bool BufferPoolInstance::try_claim_frame(Page* page, int pin_count) {
+    return page->pin_count_.compare_exchange_strong(pin_count, -1, std::memory_order_acq_rel);
+}
+
+/**
+ * @description: 不加latch查找并pin住已在缓冲池中的页面
+ * @return {Page*} 目标页面，页面不在缓冲池中、正被替换或读入失败时返回nullptr，由调用者在latch内重试
+ * @note 页表的无锁查找结果可能已过期，因此先用CAS增加pin_count（帧正被替换时pin_count为-1，CAS失败），
+ * pin住之后帧不会再被替换，再核对帧中的PageId
+ */
+Page* BufferPoolInstance::try_fetch_resident(PageId page_id) {
+    frame_id_t fid;
+    if (!page_table_.find(page_id, &fid)) {
+        return nullptr;
+    }
+    Page* page = &pages_[fid];
+    int pin_count = page->pin_count_.load(std::memory_order_acquire);
+    do {
+        if (pin_count < 0) {
+            return nullptr;
+        }
+    } while (!page->pin_count_.compare_exchange_weak(pin_count, pin_count + 1, std::memory_order_acq_rel));
+    if (!(page->id_ == page_id) || !wait_for_io(page)) {
+        std::scoped_lock lock{latch_};
+        unpin_frame(fid);
+        return nullptr;
+    }
+    replacer_->pin(fid);
+    // 预读装入的页面第一次被访问时才算作真正的访问
+    replacer_->record_access(fid, page->prefetched_.exchange(false));
+    hit_count_.fetch_add(1, std::memory_order_relaxed);
+    return page;
+}
+
+/**
+ * @description: 在帧中建立目标页面的映射并pin住，页面内容需由调用者在latch之外读入，调用者需持有latch_
+ * @return {Page*} 帧对应的Page，返回时调用者持有其io_latch_
+ * @param {frame_id_t} frame_id 从get_frame得到的可用帧
+ * @param {PageId} page_id 装入的页面
+ * @param {BufferRing*} ring 批量访问使用的子环，可以为nullptr
+ * @param {bool} prefetched 是否由预读装入
+ */
+Page* BufferPoolInstance::install_page(frame_id_t frame_id, PageId page_id, BufferRing *ring, bool prefetched) {
+    Page* page = &pages_[frame_id];
+    page->id_ = page_id;
+    page->is_dirty_ = false;
+    page->io_error_ = false;
+    page->io_in_progress_ = true;
+    page->prefetched_ = prefetched;
+    // 该帧刚被取出，不会有其他线程持有其io_latch_；在发布到页表之前加锁，无锁命中的线程会在上面等待读入完成
+    page->io_latch_.lock();
+    // 先填好帧再将其发布到页表中
+    page->pin_count_.store(1, std::memory_order_release);
+    page_table_.insert(page_id, frame_id);
+    replacer_->pin(frame_id);
+    replacer_->record_access(frame_id, true);
+    if (ring != nullptr) {
+        ring->add(frame_id, page_id);
+    }
+    return page;
+}
+
+/**
+ * @description: 将指向文件映射的帧的内容复制回帧自己的数据区，之后才能修改页面，调用者需pin住该帧
+ * @note 映射与复制出的内容相同，仍持有旧data_的读者可以继续读取映射，因此不需要等待页面的读锁，
+ * 只用io_latch_避免多个线程同时复制
+ */
+void BufferPoolInstance::unmap_frame(Page* page) {
+    if (!page->mapped_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::scoped_lock io_lock{page->io_latch_};
+    if (!page->mapped_) {
+        return;
+    }
+    memcpy(page->frame_, page->get_data(), PAGE_SIZE);
+    page->data_.store(page->frame_, std::memory_order_release);
+    page->mapped_.store(false, std::memory_order_release);
+}
+
+/**
+ * @description: 获取页面并pin住，缓冲池中没有该页面时从磁盘读入
+ * @return {Page*} 目标页面，缓冲池已满时返回nullptr
+ * @param {PageId} page_id 目标页面
+ * @param {BufferRing*} ring 批量访问使用的子环，缺页时只复用环中的帧，为nullptr时使用共享的帧
+ * @param {bool} read_only 调用者只读取页面。开启mmap读路径时，缺页的帧直接指向文件映射而不复制；
+ * 为false时命中这样的帧会先将内容复制回帧中
+ */
+Page* BufferPoolInstance::fetch_page(PageId page_id, BufferRing *ring, bool read_only) {
+    // 0. 命中时不需要获取latch
+    if (Page* page = try_fetch_resident(page_id)) {
+        if (!read_only) unmap_frame(page);
+        return page;
+    }
+    std::unique_lock lock{latch_};
+    while (true) {
+        // 1. 在页表中查找
+        frame_id_t fid;
+        if (page_table_.find(page_id, &fid)) {
+            Page* page = &pages_[fid];
+            replacer_->pin(fid);
+            // 预读装入的页面第一次被访问时才算作真正的访问
+            replacer_->record_access(fid, page->prefetched_.exchange(false));
+            page->pin_count_++;
+            hit_count_.fetch_add(1, std::memory_order_relaxed);
+            lock.unlock();
+            // 页面可能正由其他线程读入，只需在该帧上等待
+            if (wait_for_io(page)) {
+                if (!read_only) unmap_frame(page);
+                return page;
+            }
+            lock.lock();
+            unpin_frame(fid);
+            continue;
+        }
+
+        // 2. 获取替换页
+        if (!get_frame(lock, ring, &fid)) {
+            return nullptr;
+        }
+        // 写回脏页时释放过latch，目标页面可能已被其他线程读入
+        if (page_table_.contains(page_id)) {
+            free_list_.push_front(fid);
+            continue;
+        }
+
+        // 3. 建立新映射，并在latch之外读入新页
+        Page* page = install_page(fid, page_id, ring);
+        miss_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock io_lock{page->io_latch_, std::adopt_lock};
+        lock.unlock();
+        if (read_only) {
+            if (const char* mapped = disk_manager_->map_page(page_id.fd, page_id.page_no)) {
+                page->data_.store(const_cast<char*>(mapped), std::memory_order_release);
+                page->mapped_.store(true, std::memory_order_release);
+                page->io_in_progress_ = false;
+                return page;
+            }
+        }
+        try {
+            disk_manager_->read_page(page_id.fd, page_id.page_no, page->get_data(), PAGE_SIZE);
+        } catch (...) {
+            page->io_error_ = true;
+            page->io_in_progress_ = false;
+            io_lock.unlock();
+            lock.lock();
+            page_table_.erase(page_id);
+            unpin_frame(fid);
+            throw;
+        }
+        page->io_in_progress_ = false;
+        return page;
+    }
+}
+
+bool BufferPoolInstance::unpin_page(PageId page_id, bool is_dirty) {
+    std::scoped_lock lock{latch_};
+    frame_id_t fid;
+    if (!page_table_.find(page_id, &fid)) return false;
+
+    Page* page = &pages_[fid];
+
+    if (page->pin_count_ <= 0) return false;
+
+    if (is_dirty) {
+        page->is_dirty_ = true;
+    }
+    // 页面也可能是pin住期间由BufferPoolManager::mark_dirty标记的
+    if (page->is_dirty_) {
+        track_dirty(page);
+    }
+
+    unpin_frame(fid);
+    return true;
+}
+
+bool BufferPoolInstance::flush_page(PageId page_id) {
+    std::unique_lock lock{latch_};
+    frame_id_t fid;
+    if (!page_table_.find(page_id, &fid)) return false;
+
+    Page* page = &pages_[fid];
+    // pin住该帧，防止写回期间被替换
+    replacer_->pin(fid);
+    page->pin_count_++;
+    lock.unlock();
+    if (!wait_for_io(page)) {
+        lock.lock();
+        unpin_frame(fid);
+        return false;
+    }
+    try {
+        write_back(page, true);
+    } catch (...) {
+        lock.lock();
+        unpin_frame(fid);
+        throw;
+    }
+    lock.lock();
+    unpin_frame(fid);
+    return true;
+}
+
+Page* BufferPoolInstance::new_page(PageId* page_id, BufferRing *ring) {
+    std::unique_lock lock{latch_};
+    frame_id_t fid;
+    // 1. 获取 victim frame（脏页已在其中写回）
+    if (!get_frame(lock, ring, &fid)) {
+        return nullptr;
+    }
+
+    Page* page = &pages_[fid];
+
+    // 2. 分配新页号
+    page_id->page_no = disk_manager_->allocate_page(page_id->fd);
+
+    // 3. 初始化新页
+    page->id_ = *page_id;
+    page->is_dirty_ = false; // 新页初始为非脏，虽然内存可能是脏的，但逻辑上是新空白页
+    page->io_error_ = false;
+    page->prefetched_ = false;
+    // 注意：Rucbase 测试通常要求 new_page 返回的页内容清零，或者直接覆盖使用
+    memset(page->get_data(), 0, PAGE_SIZE);
+
+    // 4. 更新页表
+    page->pin_count_.store(1, std::memory_order_release);
+    page_table_.insert(*page_id, fid);
+    replacer_->pin(fid);
+    replacer_->record_access(fid, true);
+    if (ring != nullptr) {
+        ring->add(fid, *page_id);
+    }
+
+    return page;
+}
+
+bool BufferPoolInstance::delete_page(PageId page_id) {
+    std::unique_lock lock{latch_};
+    frame_id_t fid;
+    if (!page_table_.find(page_id, &fid)) return true;
+
+    Page* page = &pages_[fid];
+
+    if (page->pin_count_ > 0) return false;
+
+    if (page->is_dirty_) {
+        replacer_->pin(fid);
+        page->pin_count_++;
+        lock.unlock();
+        try {
+            write_back(page);
+        } catch (...) {
+            lock.lock();
+            unpin_frame(fid);
+            throw;
+        }
+        lock.lock();
+        if (!try_claim_frame(page, 1)) {
+            unpin_frame(fid);  // 写回期间被其他线程pin住
+            return false;
+        }
+    } else if (!try_claim_frame(page)) {
+        return false;  // 被无锁命中pin住
+    }
+
+    untrack_dirty(page_id);
+    page_table_.erase(page_id);
+    replacer_->pin(fid);
+    page->id_.page_no = INVALID_PAGE_ID;
+    page->is_dirty_ = false;
+
+    // 归还到空闲链表
+    free_list_.push_back(fid);
+    return true;
+}
+
+/**
+ * @description: pin住本分区中属于指定文件的所有脏页，按页号升序传出，写回后需调用unpin_frames
+ * @param {int} fd 文件句柄
+ * @param {vector<Page*>*} pages 传出被pin住的脏页
+ * @note 只遍历该文件的脏页集合，代价与脏页个数成正比；已被写回的页面在这里从集合中移除
+ */
+void BufferPoolInstance::pin_dirty_pages(int fd, std::vector<Page*> *pages) {
+    std::scoped_lock lock{latch_};
+    auto it = dirty_pages_.find(fd);
+    if (it == dirty_pages_.end()) {
+        return;
+    }
+    auto &dirty = it->second;
+    for (auto entry = dirty.begin(); entry != dirty.end();) {
+        Page* page = &pages_[entry->second];
+        if (!page->is_dirty_) {
+            entry = dirty.erase(entry);
+            continue;
+        }
+        replacer_->pin(entry->second);
+        page->pin_count_++;
+        pages->push_back(page);
+        ++entry;
+    }
+    if (dirty.empty()) {
+        dirty_pages_.erase(it);
+    }
+}
+
+/**
+ * @description: 将被pin住的页面标记为脏页，调用者不能持有latch_
+ */
+void BufferPoolInstance::mark_dirty(Page* page) {
+    std::scoped_lock lock{latch_};
+    page->is_dirty_ = true;
+    track_dirty(page);
+}
+
+/**
+ * @description: 将页面加入所在文件的脏页集合，调用者需持有latch_
+ */
+void BufferPoolInstance::track_dirty(Page* page) {
+    dirty_pages_[page->id_.fd][page->id_.page_no] = static_cast<frame_id_t>(page - pages_);
+}
+
+/**
+ * @description: 页面被替换或删除时将其移出脏页集合，调用者需持有latch_
+ */
+void BufferPoolInstance::untrack_dirty(const PageId &page_id) {
+    auto it = dirty_pages_.find(page_id.fd);
+    if (it == dirty_pages_.end()) {
+        return;
+    }
+    it->second.erase(page_id.page_no);
+    if (it->second.empty()) {
+        dirty_pages_.erase(it);
+    }
+}
+
+/**
+ * @description: 供后台写线程使用，挑选即将被替换的脏页并pin住
+ * @param {size_t} target_clean 希望保持的可直接替换的干净帧（空闲帧或即将被替换的干净页面）个数
+ * @param {size_t} max_pages 本次最多挑选的脏页个数
+ * @param {vector<Page*>*} pages 传出被pin住的脏页，写回后需调用unpin_frames
+ * @note 按replacer的淘汰顺序查看接下来的target_clean个victim，其中的脏页需要提前写回。
+ * 这里只增加pin_count而不将帧移出replacer，以免改变它在淘汰顺序中的位置；
+ * 替换时会跳过pin_count大于0的victim
+ */
+void BufferPoolInstance::pin_dirty_frames(size_t target_clean, size_t max_pages, std::vector<Page*> *pages) {
+    std::scoped_lock lock{latch_};
+    if (free_list_.size() >= target_clean) {
+        return;
+    }
+    std::vector<frame_id_t> candidates;
+    replacer_->victim_candidates(&candidates, target_clean - free_list_.size());
+    for (frame_id_t fid : candidates) {
+        if (pages->size() >= max_pages) {
+            break;
+        }
+        Page* page = &pages_[fid];
+        if (page->pin_count_ == 0 && page->is_dirty_) {
+            page->pin_count_++;
+            pages->push_back(page);
+        }
+    }
+}
+
+/**
+ * @description: 供后台写线程使用，释放pin_dirty_frames对页面的pin
+ */
+void BufferPoolInstance::unpin_frames(const std::vector<Page*> &pages) {
+    std::scoped_lock lock{latch_};
+    for (Page* page : pages) {
+        unpin_frame(static_cast<frame_id_t>(page - pages_));
+    }
+}
+
+/**
+ * @description: 列出本分区中的页面，按最近访问的先后排列：被pin住的页面在前，其余的按替换策略淘汰顺序的逆序
+ * @param {vector<PageId>*} page_ids 追加本分区的页面
+ */
+void BufferPoolInstance::get_resident_pages(std::vector<PageId> *page_ids) {
+    std::scoped_lock lock{latch_};
+    std::vector<frame_id_t> candidates;
+    replacer_->victim_candidates(&candidates, pool_size_);
+    for (size_t i = 0; i < pool_size_; ++i) {
+        if (pages_[i].pin_count_.load() > 0 && !pages_[i].io_error_) {
+            page_ids->push_back(pages_[i].id_);
+        }
+    }
+    for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+        page_ids->push_back(pages_[*it].id_);
+    }
+}
+
+/**
+ * @description: 为预读保留一个帧并建立页面映射，页面已在缓冲池中或没有可用帧时返回nullptr
+ * @return {Page*} 被pin住的页面，调用者持有其io_latch_，读入后需调用end_prefetch
+ * @param {PageId} page_id 预读的页面
+ * @param {BufferRing*} ring 批量访问使用的子环，可以为nullptr
+ * @note 在读入完成之前访问该页面的线程会在io_latch_上等待
+ */
+Page* BufferPoolInstance::begin_prefetch(PageId page_id, BufferRing *ring) {
+    std::unique_lock lock{latch_};
+    if (page_table_.contains(page_id)) {
+        return nullptr;
+    }
+    frame_id_t fid;
+    if (!get_frame(lock, ring, &fid)) {
+        return nullptr;
+    }
+    if (page_table_.contains(page_id)) {
+        free_list_.push_front(fid);
+        return nullptr;
+    }
+    return install_page(fid, page_id, ring, true);
+}
+
+/**
+ * @description: 结束预读，释放io_latch_和pin，读入失败时移除页面映射，之后访问该页面的线程会自己重新读入
+ * @param {Page*} page begin_prefetch返回的页面
+ * @param {bool} success 是否读入成功
+ */
+void BufferPoolInstance::end_prefetch(Page* page, bool success) {
+    if (!success) {
+        page->io_error_ = true;
+    }
+    page->io_in_progress_ = false;
+    page->io_latch_.unlock();
+    std::scoped_lock lock{latch_};
+    if (!success) {
+        page_table_.erase(page->id_);
+    }
+    unpin_frame(static_cast<frame_id_t>(page - pages_));
+}
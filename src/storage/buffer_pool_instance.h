@@ -0,0 +1,151 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "buffer_access_strategy.h"
+#include "disk_manager.h"
+#include "errors.h"
+#include "page.h"
+#include "page_table.h"
+#include "replacer/clock_replacer.h"
+#include "replacer/lru_k_replacer.h"
+#include "replacer/lru_replacer.h"
+#include "replacer/replacer.h"
+
+/**
+ * @description: 缓冲池的一个分区。每个分区拥有独立的页表、空闲链表、置换策略和互斥锁，
+ * 由BufferPoolManager根据PageId的哈希值将页面分派到各个分区，分区之间互不阻塞
+ */
+class BufferPoolInstance {
+   private:
+    size_t pool_size_;      // 本分区可容纳页面的个数，即帧的个数
+    Page *pages_;           // 本分区帧的元数据数组，在构造函数中申请内存空间，在析构函数中释放
+    PageTable page_table_;  // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号，查找可以不加latch
+    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+    // 每个文件在本分区中的脏页，按页号排序；包含所有脏页，但其中的页面可能已被写回，在刷盘或被替换时移除
+    std::unordered_map<int, std::map<page_id_t, frame_id_t>> dirty_pages_;
+    DiskManager *disk_manager_;
+    Replacer *replacer_;    // 本分区的置换策略
+    std::mutex latch_;      // 用于本分区页表、空闲链表、replacer和pin_count的并发控制，磁盘I/O在latch之外进行
+    std::atomic<uint64_t> hit_count_{0};    // fetch_page在缓冲池中命中的次数
+    std::atomic<uint64_t> miss_count_{0};   // fetch_page需要从磁盘读入的次数
+    std::atomic<uint64_t> foreground_write_count_{0};   // 前台线程替换页面时自己写回脏页的次数
+    std::atomic<uint64_t> background_write_count_{0};   // 后台写线程写回脏页的次数
+
+   public:
+    /**
+     * @param {size_t} pool_size 本分区的帧数
+     * @param {char*} frames 本分区帧的数据区，连续的pool_size个页面，由BufferPoolManager的FrameArena分配
+     * @param {DiskManager*} disk_manager
+     * @param {string&} replacer_type 置换策略
+     */
+    BufferPoolInstance(size_t pool_size, char *frames, DiskManager *disk_manager,
+                       const std::string &replacer_type = REPLACER_TYPE)
+        : pool_size_(pool_size), page_table_(pool_size), disk_manager_(disk_manager) {
+        // 帧的元数据与数据分开存放
+        pages_ = new Page[pool_size_];
+        for (size_t i = 0; i < pool_size_; ++i) {
+            pages_[i].frame_ = frames + i * PAGE_SIZE;
+            pages_[i].data_.store(pages_[i].frame_, std::memory_order_relaxed);
+        }
+        // 可以被Replacer改变
+        if (replacer_type == "CLOCK")
+            replacer_ = new ClockReplacer(pool_size_);
+        else if (replacer_type == "LRUK")
+            replacer_ = new LRUKReplacer(pool_size_);
+        else {
+            replacer_ = new LRUReplacer(pool_size_);
+        }
+        // 初始化时，所有的page都在free_list_中
+        for (size_t i = 0; i < pool_size_; ++i) {
+            free_list_.emplace_back(static_cast<frame_id_t>(i));  // static_cast转换数据类型
+            pages_[i].pin_count_ = -1;
+        }
+    }
+
+    ~BufferPoolInstance() {
+        delete[] pages_;
+        delete replacer_;
+    }
+
+    size_t get_pool_size() const { return pool_size_; }
+
+    uint64_t get_hit_count() const { return hit_count_.load(std::memory_order_relaxed); }
+
+    uint64_t get_miss_count() const { return miss_count_.load(std::memory_order_relaxed); }
+
+    uint64_t get_foreground_write_count() const { return foreground_write_count_.load(std::memory_order_relaxed); }
+
+    uint64_t get_background_write_count() const { return background_write_count_.load(std::memory_order_relaxed); }
+
+    Page* fetch_page(PageId page_id, BufferRing *ring = nullptr, bool read_only = false);
+
+    bool unpin_page(PageId page_id, bool is_dirty);
+
+    bool flush_page(PageId page_id);
+
+    Page* new_page(PageId* page_id, BufferRing *ring = nullptr);
+
+    bool delete_page(PageId page_id);
+
+    void pin_dirty_pages(int fd, std::vector<Page*> *pages);
+
+    void mark_dirty(Page* page);
+
+    void pin_dirty_frames(size_t target_clean, size_t max_pages, std::vector<Page*> *pages);
+
+    void count_background_write() { background_write_count_.fetch_add(1, std::memory_order_relaxed); }
+
+    void unpin_frames(const std::vector<Page*> &pages);
+
+    Page* begin_prefetch(PageId page_id, BufferRing *ring);
+
+    void end_prefetch(Page* page, bool success);
+
+    void get_resident_pages(std::vector<PageId> *page_ids);
+
+   private:
+    Page* try_fetch_resident(PageId page_id);
+
+    bool try_claim_frame(Page* page, int pin_count = 0);
+
+    bool find_victim_page(std::unique_lock<std::mutex> &lock, frame_id_t* frame_id);
+
+    bool get_ring_frame(std::unique_lock<std::mutex> &lock, BufferRing *ring, frame_id_t* frame_id);
+
+    bool get_frame(std::unique_lock<std::mutex> &lock, BufferRing *ring, frame_id_t* frame_id);
+
+    Page* install_page(frame_id_t frame_id, PageId page_id, BufferRing *ring, bool prefetched = false);
+
+    void unmap_frame(Page* page);
+
+    bool write_back(Page* page, bool force = false);
+
+    bool wait_for_io(Page* page);
+
+    void unpin_frame(frame_id_t frame_id);
+
+    void track_dirty(Page* page);
+
+    void untrack_dirty(const PageId &page_id);
+};
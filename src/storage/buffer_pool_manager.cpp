@@ -10,158 +10,542 @@ See the Mulan PSL v2 for more details. */
 
 #include "buffer_pool_manager.h"
 
-bool BufferPoolManager::find_victim_page(frame_id_t* frame_id) {
-    // 1. 检查空闲链表
-    if (!free_list_.empty()) {
-        *frame_id = free_list_.front();
-        free_list_.pop_front();
-        return true;
-    }
-    // 2. 检查 Replacer
-    if (replacer_->victim(frame_id)) {
-        return true;
-    }
-    return false;
-}
-
-Page* BufferPoolManager::fetch_page(PageId page_id) {
-    std::scoped_lock lock{latch_};
-    // 1. 在页表中查找
-    auto it = page_table_.find(page_id);
-    if (it != page_table_.end()) {
-        frame_id_t fid = it->second;
-        replacer_->pin(fid);
-        pages_[fid].pin_count_++;
-        return &pages_[fid];
-    }
-
-    // 2. 获取替换页
-    frame_id_t fid;
-    if (!find_victim_page(&fid)) {
-        return nullptr;
-    }
-
-    Page* page = &pages_[fid];
-    
-    // 3. 写回脏页
-    if (page->is_dirty_) {
-        disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
-        page->is_dirty_ = false;
+#include <algorithm>
+#include <iostream>
+
+BufferPoolManager::BufferPoolManager(size_t pool_size, DiskManager *disk_manager, size_t num_instances,
+                                     const std::string &replacer_type)
+    : pool_size_(pool_size),
+      disk_manager_(disk_manager),
+      arena_(pool_size),
+      scan_readahead_pages_(get_config_int("SCAN_READAHEAD", SCAN_READAHEAD_PAGES, 0, MAX_SCAN_READAHEAD_PAGES)) {
+    // 未指定分区个数时，在保证每个分区至少有MIN_FRAMES_PER_INSTANCE帧的前提下尽量多分区
+    if (num_instances == 0) {
+        num_instances = std::min<size_t>(BUFFER_POOL_INSTANCES, pool_size_ / MIN_FRAMES_PER_INSTANCE);
+    }
+    num_instances = std::max<size_t>(1, std::min(num_instances, pool_size_));
+    // 帧数不能整除时，余下的帧分给前面的分区
+    size_t offset = 0;
+    for (size_t i = 0; i < num_instances; ++i) {
+        size_t frames = pool_size_ / num_instances + (i < pool_size_ % num_instances ? 1 : 0);
+        instances_.emplace_back(
+            std::make_unique<BufferPoolInstance>(frames, arena_.get_frame(offset), disk_manager_, replacer_type));
+        offset += frames;
     }
+}
+
+/**
+ * @description: 根据PageId选择其所属的分区
+ * @return {size_t} 页面所属分区的下标
+ * @param {PageId&} page_id 目标页面
+ */
+size_t BufferPoolManager::get_instance_idx(const PageId &page_id) {
+    if (instances_.size() == 1) return 0;
+    // 将(fd, page_no)打散，避免同一文件的连续页面集中到同一个分区
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(page_id.fd)) << 32) |
+                   static_cast<uint32_t>(page_id.page_no);
+    key *= 0x9E3779B97F4A7C15ULL;
+    return (key >> 32) % instances_.size();
+}
 
-    // 4. 从页表中移除旧页
-    page_table_.erase(page->id_);
+/**
+ * @description: 获取访问策略在指定分区中的子环
+ * @return {BufferRing*} 子环，strategy为nullptr时返回nullptr
+ */
+BufferRing* BufferPoolManager::get_ring(BufferAccessStrategy *strategy, size_t instance_idx) {
+    if (strategy == nullptr) return nullptr;
+    return strategy->get_ring(instance_idx, instances_.size(), pool_size_);
+}
 
-    // 5. 读入新页
-    page_table_[page_id] = fid;
-    page->id_ = page_id;
-    page->pin_count_ = 1;
-    disk_manager_->read_page(page_id.fd, page_id.page_no, page->data_, PAGE_SIZE);
-    replacer_->pin(fid);
+Page* BufferPoolManager::fetch_page(PageId page_id) { return get_instance(page_id)->fetch_page(page_id); }
 
-    return page;
+/**
+ * @description: 使用批量访问策略获取页面，缺页时只复用策略私有的环形缓冲区中的帧
+ * @return {Page*} 目标页面，缓冲池已满时返回nullptr
+ * @param {PageId} page_id 目标页面
+ * @param {BufferAccessStrategy*} strategy 访问策略，为nullptr时与fetch_page(page_id)相同
+ */
+Page* BufferPoolManager::fetch_page(PageId page_id, BufferAccessStrategy *strategy) {
+    size_t idx = get_instance_idx(page_id);
+    return instances_[idx]->fetch_page(page_id, get_ring(strategy, idx));
 }
 
 bool BufferPoolManager::unpin_page(PageId page_id, bool is_dirty) {
-    std::scoped_lock lock{latch_};
-    auto it = page_table_.find(page_id);
-    if (it == page_table_.end()) return false;
+    return get_instance(page_id)->unpin_page(page_id, is_dirty);
+}
 
-    frame_id_t fid = it->second;
-    Page* page = &pages_[fid];
+bool BufferPoolManager::flush_page(PageId page_id) { return get_instance(page_id)->flush_page(page_id); }
 
-    if (page->pin_count_ <= 0) return false;
+/**
+ * @description: 在page_id->fd对应的文件中创建一个新页面
+ * @return {Page*} 新页面，缓冲池已满时返回nullptr
+ * @param {PageId*} page_id 传入fd，传出新分配的页面号
+ * @note 新页面号要在分区取得空闲帧之后才由DiskManager分配，而分区又要根据页面号确定，
+ * 因此同一文件的new_page需串行执行，保证这里预先读到的页面号就是分区内实际分配的页面号
+ */
+Page* BufferPoolManager::new_page(PageId* page_id) { return new_page(page_id, nullptr); }
 
-    if (is_dirty) page->is_dirty_ = true;
+/**
+ * @description: 使用批量访问策略创建新页面，供批量导入使用
+ * @param {BufferAccessStrategy*} strategy 访问策略，为nullptr时使用共享的帧
+ */
+Page* BufferPoolManager::new_page(PageId* page_id, BufferAccessStrategy *strategy) {
+    std::scoped_lock lock{alloc_latches_[page_id->fd % ALLOC_LATCH_NUM]};
+    PageId next_page_id = {.fd = page_id->fd, .page_no = disk_manager_->get_fd2pageno(page_id->fd)};
+    size_t idx = get_instance_idx(next_page_id);
+    Page* page = instances_[idx]->new_page(page_id, get_ring(strategy, idx));
+    assert(page == nullptr || page_id->page_no == next_page_id.page_no);
+    return page;
+}
 
-    page->pin_count_--;
-    if (page->pin_count_ == 0) {
-        replacer_->unpin(fid);
-    }
-    return true;
+/**
+ * @description: 获取页面并加读锁，返回的句柄析构时自动解锁并unpin
+ * @return {ReadPageGuard} 缓冲池已满时返回无效的句柄
+ */
+ReadPageGuard BufferPoolManager::fetch_page_read(PageId page_id, BufferAccessStrategy *strategy) {
+    // 只读访问，开启mmap读路径时页面可以直接指向文件映射
+    size_t idx = get_instance_idx(page_id);
+    return ReadPageGuard(this, instances_[idx]->fetch_page(page_id, get_ring(strategy, idx), true));
 }
 
-bool BufferPoolManager::flush_page(PageId page_id) {
-    std::scoped_lock lock{latch_};
-    auto it = page_table_.find(page_id);
-    if (it == page_table_.end()) return false;
-    
-    frame_id_t fid = it->second;
-    Page* page = &pages_[fid];
-    disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
-    page->is_dirty_ = false;
-    return true;
+/**
+ * @description: 获取页面并加写锁，返回的句柄析构时自动解锁，并以脏页unpin
+ * @return {WritePageGuard} 缓冲池已满时返回无效的句柄
+ */
+WritePageGuard BufferPoolManager::fetch_page_write(PageId page_id) {
+    return WritePageGuard(this, fetch_page(page_id));
 }
 
-Page* BufferPoolManager::new_page(PageId* page_id) {
-    std::scoped_lock lock{latch_};
-    frame_id_t fid;
-    // 1. 获取 victim frame
-    if (!find_victim_page(&fid)) {
-        return nullptr;
+/**
+ * @description: 创建新页面并加写锁
+ * @return {WritePageGuard} 缓冲池已满时返回无效的句柄
+ */
+WritePageGuard BufferPoolManager::new_page_write(PageId* page_id) { return WritePageGuard(this, new_page(page_id)); }
+
+bool BufferPoolManager::delete_page(PageId page_id) { return get_instance(page_id)->delete_page(page_id); }
+
+/**
+ * @description: 将指定文件的所有脏页写回磁盘
+ * @param {int} fd 文件句柄
+ * @note 只访问各分区中该文件的脏页集合，代价与脏页个数成正比而与缓冲池大小无关；
+ * 各分区的脏页合并后按页号排序，相邻的页面合并为一次向量写
+ */
+void BufferPoolManager::flush_all_pages(int fd) {
+    std::vector<std::vector<Page*>> pinned(instances_.size());
+    std::vector<Page*> pages;
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i]->pin_dirty_pages(fd, &pinned[i]);
+        pages.insert(pages.end(), pinned[i].begin(), pinned[i].end());
     }
+    // 页面被pin住，id_不会改变
+    std::sort(pages.begin(), pages.end(),
+              [](const Page* a, const Page* b) { return a->id_.page_no < b->id_.page_no; });
 
-    Page* page = &pages_[fid];
+    std::exception_ptr error;
+    try {
+        write_back_pages(fd, pages);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i]->unpin_frames(pinned[i]);
+    }
+    if (error) std::rethrow_exception(error);
+}
 
-    // 2. 写回脏页
-    if (page->is_dirty_) {
-        disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
-        page->is_dirty_ = false;
+/**
+ * @description: 写回一组被pin住的页面，页号连续的脏页合并为一次向量写
+ * @param {int} fd 页面所在的文件
+ * @param {vector<Page*>&} pages 按页号升序排列的页面
+ * @note 与write_back相同，写回期间持有每个页面的io_latch_和读锁。一段连续页面中除第一个页面外都只尝试加锁，
+ * 加锁失败时在此处截断，避免与按其他顺序持有多个页面写锁的线程死锁
+ */
+void BufferPoolManager::write_back_pages(int fd, const std::vector<Page*> &pages) {
+    std::vector<Page*> run;
+    std::vector<const char*> bufs;
+    auto unlock = [](Page* page) {
+        page->rwlatch_.unlock_shared();
+        page->io_latch_.unlock();
+    };
+    size_t i = 0;
+    while (i < pages.size()) {
+        run.clear();
+        Page* first = pages[i++];
+        first->io_latch_.lock();
+        first->rwlatch_.lock_shared();
+        if (!first->is_dirty_) {
+            unlock(first);  // 已被后台写线程或替换写回
+            continue;
+        }
+        run.push_back(first);
+        while (i < pages.size() && pages[i]->id_.page_no == run.back()->id_.page_no + 1) {
+            Page* page = pages[i];
+            if (!page->io_latch_.try_lock()) break;
+            if (!page->rwlatch_.try_lock_shared()) {
+                page->io_latch_.unlock();
+                break;
+            }
+            if (!page->is_dirty_) {
+                unlock(page);
+                break;
+            }
+            run.push_back(page);
+            i++;
+        }
+
+        // 先清除脏标记再写回，写回期间被修改的页面会重新被标记为脏页
+        bufs.clear();
+        for (Page* page : run) {
+            page->is_dirty_ = false;
+            bufs.push_back(page->get_data());
+        }
+        std::exception_ptr error;
+        try {
+            disk_manager_->write_pages(fd, first->id_.page_no, bufs.data(), static_cast<int>(run.size()));
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for (Page* page : run) {
+            unlock(page);
+        }
+        if (error) {
+            // 写回期间页面可能被其他线程当作干净页面移出了脏页集合
+            for (Page* page : run) {
+                mark_dirty(page);
+            }
+            std::rethrow_exception(error);
+        }
     }
+}
 
-    // 3. 更新页表
-    page_table_.erase(page->id_);
+uint64_t BufferPoolManager::get_hit_count() const {
+    uint64_t count = 0;
+    for (auto &instance : instances_) {
+        count += instance->get_hit_count();
+    }
+    return count;
+}
 
-    // 4. 分配新页号
-    page_id->page_no = disk_manager_->allocate_page(page_id->fd);
-    
-    // 5. 初始化新页
-    page->id_ = *page_id;
-    page->pin_count_ = 1;
-    page->is_dirty_ = false; // 新页初始为非脏，虽然内存可能是脏的，但逻辑上是新空白页
-    // 注意：Rucbase 测试通常要求 new_page 返回的页内容清零，或者直接覆盖使用
-    memset(page->data_, 0, PAGE_SIZE); 
+uint64_t BufferPoolManager::get_miss_count() const {
+    uint64_t count = 0;
+    for (auto &instance : instances_) {
+        count += instance->get_miss_count();
+    }
+    return count;
+}
 
-    page_table_[*page_id] = fid;
-    replacer_->pin(fid);
+uint64_t BufferPoolManager::get_foreground_write_count() const {
+    uint64_t count = 0;
+    for (auto &instance : instances_) {
+        count += instance->get_foreground_write_count();
+    }
+    return count;
+}
 
-    return page;
+uint64_t BufferPoolManager::get_background_write_count() const {
+    uint64_t count = 0;
+    for (auto &instance : instances_) {
+        count += instance->get_background_write_count();
+    }
+    return count;
 }
 
-bool BufferPoolManager::delete_page(PageId page_id) {
-    std::scoped_lock lock{latch_};
-    auto it = page_table_.find(page_id);
-    if (it == page_table_.end()) return true;
+/**
+ * @description: 启动后台写线程，周期性地写回未被pin住的脏页，使每个分区保持一定数量的干净帧，
+ * 前台线程替换页面时就不必再同步写回别人的脏页
+ * @param {size_t} target_clean 整个缓冲池希望保持的干净帧个数，平均分给各个分区
+ * @param {milliseconds} interval 两轮写回之间的间隔
+ */
+void BufferPoolManager::start_page_cleaner(size_t target_clean, std::chrono::milliseconds interval) {
+    std::scoped_lock lock{cleaner_latch_};
+    if (cleaner_running_) return;
+    cleaner_running_ = true;
+    cleaner_thread_ = std::thread([this, target_clean, interval] {
+        // 后台写线程独占一个I/O引擎，每轮的写回同时进行
+        std::unique_ptr<AsyncIOEngine> engine;
+        try {
+            engine = AsyncIOEngine::create(ASYNC_IO_QUEUE_DEPTH, get_config("IO_ENGINE", ""), disk_manager_);
+        } catch (std::exception &e) {
+            std::cerr << "page cleaner: " << e.what() << std::endl;
+        }
+        std::unique_lock lock{cleaner_latch_};
+        while (cleaner_running_) {
+            lock.unlock();
+            try {
+                clean_pages(target_clean, PAGE_CLEANER_MAX_PAGES, engine.get());
+            } catch (std::exception &e) {
+                // 写回失败的页面仍为脏页，之后由下一轮或前台线程重试
+                std::cerr << "page cleaner: " << e.what() << std::endl;
+            }
+            lock.lock();
+            cleaner_cv_.wait_for(lock, interval, [this] { return !cleaner_running_; });
+        }
+    });
+}
 
-    frame_id_t fid = it->second;
-    Page* page = &pages_[fid];
+/**
+ * @description: 停止后台写线程，等待正在进行的一轮写回结束
+ */
+void BufferPoolManager::stop_page_cleaner() {
+    {
+        std::scoped_lock lock{cleaner_latch_};
+        if (!cleaner_running_) return;
+        cleaner_running_ = false;
+    }
+    cleaner_cv_.notify_all();
+    cleaner_thread_.join();
+}
 
-    if (page->pin_count_ > 0) return false;
+/**
+ * @description: 后台写线程的一轮写回。先在各个分区挑选并pin住需要写回的脏页，
+ * 再按(fd, page_no)排序后通过异步I/O引擎一次提交，使多个写回同时进行
+ * @param {size_t} target_clean 整个缓冲池希望保持的干净帧个数
+ * @param {size_t} max_pages 本轮最多写回的页面个数
+ * @param {AsyncIOEngine*} engine 使用的I/O引擎，为nullptr时临时创建一个
+ */
+void BufferPoolManager::clean_pages(size_t target_clean, size_t max_pages, AsyncIOEngine *engine) {
+    std::vector<std::pair<Page*, BufferPoolInstance*>> batch;
+    std::vector<std::vector<Page*>> pinned(instances_.size());
+    size_t target_per_instance = target_clean / instances_.size();
+    size_t max_per_instance = std::max<size_t>(max_pages / instances_.size(), 1);
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i]->pin_dirty_frames(target_per_instance, max_per_instance, &pinned[i]);
+        for (Page* page : pinned[i]) {
+            batch.emplace_back(page, instances_[i].get());
+        }
+    }
+    // 页面被pin住，id_不会改变
+    std::sort(batch.begin(), batch.end(), [](const auto &a, const auto &b) {
+        const PageId &x = a.first->get_page_id();
+        const PageId &y = b.first->get_page_id();
+        return x.fd != y.fd ? x.fd < y.fd : x.page_no < y.page_no;
+    });
 
-    if (page->is_dirty_) {
-        disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
+    // 与write_back相同，写回期间持有页面的io_latch_和读锁。同时持有多个页面的锁，因此只尝试加锁，
+    // 加锁失败的页面留给下一轮
+    std::vector<IORequest> requests;
+    std::vector<BufferPoolInstance*> owners;    // 每个请求的页面所在的分区
+    requests.reserve(batch.size());
+    size_t failed = 0;
+    for (auto &[page, instance] : batch) {
+        if (!page->io_latch_.try_lock()) continue;
+        if (!page->rwlatch_.try_lock_shared()) {
+            page->io_latch_.unlock();
+            continue;
+        }
+        if (!page->is_dirty_) {
+            page->rwlatch_.unlock_shared();
+            page->io_latch_.unlock();
+            continue;
+        }
         page->is_dirty_ = false;
+        if (disk_manager_->is_compressed(page->id_.fd)) {
+            // 压缩文件的页面需要经过DiskManager压缩后写入，不能交给I/O引擎直接写fd，与write_back一样同步写回
+            bool ok = true;
+            try {
+                disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->get_data(), PAGE_SIZE);
+            } catch (std::exception &) {
+                ok = false;
+            }
+            page->rwlatch_.unlock_shared();
+            page->io_latch_.unlock();
+            if (ok) {
+                instance->count_background_write();
+            } else {
+                instance->mark_dirty(page);
+                failed++;
+            }
+            continue;
+        }
+        IORequest request;
+        request.is_write = true;
+        request.fd = page->id_.fd;
+        request.page_no = page->id_.page_no;
+        request.buf = page->get_data();
+        request.user_data = page;
+        requests.push_back(request);
+        owners.push_back(instance);
     }
 
-    page_table_.erase(page_id);
-    page->id_.page_no = INVALID_PAGE_ID;
-    page->is_dirty_ = false;
-    page->pin_count_ = 0;
-    
-    // 归还到空闲链表
-    free_list_.push_back(fid);
-    return true;
+    std::exception_ptr error;
+    if (!requests.empty()) {
+        try {
+            std::unique_ptr<AsyncIOEngine> owned;
+            if (engine == nullptr) {
+                owned = AsyncIOEngine::create(ASYNC_IO_QUEUE_DEPTH, get_config("IO_ENGINE", ""), disk_manager_);
+                engine = owned.get();
+            }
+            failed += engine->execute(requests);
+        } catch (...) {
+            // 引擎出错时所有请求按失败处理
+            error = std::current_exception();
+            failed += requests.size();
+            for (auto &request : requests) request.result = -EIO;
+        }
+    }
+    for (size_t i = 0; i < requests.size(); ++i) {
+        Page* page = static_cast<Page*>(requests[i].user_data);
+        page->rwlatch_.unlock_shared();
+        page->io_latch_.unlock();
+        if (requests[i].ok()) {
+            owners[i]->count_background_write();
+        } else {
+            // 写回期间页面可能被当作干净页面移出了脏页集合
+            owners[i]->mark_dirty(page);
+        }
+    }
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i]->unpin_frames(pinned[i]);
+    }
+    if (error) std::rethrow_exception(error);
+    if (failed > 0) {
+        throw InternalError("BufferPoolManager::clean_pages: " + std::to_string(failed) + " page writes failed");
+    }
 }
 
-void BufferPoolManager::flush_all_pages(int fd) {
-    std::scoped_lock lock{latch_};
-    for (const auto& entry : page_table_) {
-        if (entry.first.fd == fd) {
-            Page* page = &pages_[entry.second];
-            if (page->is_dirty_) {
-                disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
-                page->is_dirty_ = false;
+/**
+ * @description: 异步预读提示，将从start开始的num_pages个连续页面读入缓冲池，不等待读入完成
+ * @param {PageId} start 第一个页面
+ * @param {int} num_pages 页面个数
+ * @param {shared_ptr<BufferAccessStrategy>} strategy 访问策略，预读的页面同样只使用策略的环形缓冲区
+ * @note 预读只是提示：队列过长时直接丢弃请求，已在缓冲池中的页面会被跳过
+ */
+void BufferPoolManager::prefetch_pages(PageId start, int num_pages, std::shared_ptr<BufferAccessStrategy> strategy) {
+    if (num_pages <= 0) return;
+    // 能够映射的页面在只读访问时不需要复制进缓冲池，磁盘预读交给内核对映射的预读
+    if (disk_manager_->map_page(start.fd, start.page_no) != nullptr) return;
+    if (strategy != nullptr) {
+        // 在调用者线程中初始化各个子环，预读线程之后只在分区latch的保护下使用子环
+        get_ring(strategy.get(), 0);
+    }
+    {
+        std::scoped_lock lock{prefetch_latch_};
+        if (prefetch_queue_.size() >= PREFETCH_QUEUE_LIMIT) return;
+        if (!prefetch_running_) {
+            prefetch_running_ = true;
+            prefetch_thread_ = std::thread([this] {
+                std::unique_lock lock{prefetch_latch_};
+                while (true) {
+                    prefetch_cv_.wait(lock, [this] { return !prefetch_running_ || !prefetch_queue_.empty(); });
+                    if (!prefetch_running_) break;
+                    PrefetchRequest request = std::move(prefetch_queue_.front());
+                    prefetch_queue_.pop_front();
+                    lock.unlock();
+                    do_prefetch(request);
+                    lock.lock();
+                }
+            });
+        }
+        prefetch_queue_.push_back({start, num_pages, std::move(strategy)});
+    }
+    prefetch_cv_.notify_one();
+}
+
+/**
+ * @description: 执行一次预读请求，为不在缓冲池中的页面保留帧，并将其中连续的页面用一次向量读读入
+ */
+void BufferPoolManager::do_prefetch(const PrefetchRequest &request) {
+    std::vector<std::pair<Page*, BufferPoolInstance*>> run;     // 当前连续页面段
+    std::vector<char*> bufs;
+    page_id_t run_start = INVALID_PAGE_ID;
+    auto read_run = [&]() {
+        if (run.empty()) return;
+        bool success = true;
+        try {
+            disk_manager_->read_pages(request.start.fd, run_start, bufs.data(), static_cast<int>(bufs.size()));
+        } catch (RMDBError &) {
+            // 读入失败的页面会被移除，访问它的线程会自己重新读入并得到错误
+            success = false;
+        }
+        for (auto &[page, instance] : run) {
+            instance->end_prefetch(page, success);
+        }
+        run.clear();
+        bufs.clear();
+    };
+    for (int i = 0; i < request.num_pages; i++) {
+        PageId page_id = {.fd = request.start.fd, .page_no = request.start.page_no + i};
+        size_t idx = get_instance_idx(page_id);
+        Page* page = instances_[idx]->begin_prefetch(page_id, get_ring(request.strategy.get(), idx));
+        if (page == nullptr) {
+            read_run();
+            continue;
+        }
+        if (run.empty()) run_start = page_id.page_no;
+        run.emplace_back(page, instances_[idx].get());
+        bufs.push_back(page->get_data());
+    }
+    read_run();
+}
+
+/**
+ * @description: 列出缓冲池中的所有页面，按最近访问的先后排列（最近访问的在前）。
+ * 分区之间没有统一的访问顺序，按各分区内的名次交替合并
+ * @return {vector<PageId>} 缓冲池中的页面
+ */
+std::vector<PageId> BufferPoolManager::get_resident_pages() {
+    std::vector<std::vector<PageId>> lists(instances_.size());
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i]->get_resident_pages(&lists[i]);
+    }
+    std::vector<PageId> pages;
+    for (size_t rank = 0; pages.size() < pool_size_; ++rank) {
+        size_t before = pages.size();
+        for (auto &list : lists) {
+            if (rank < list.size()) pages.push_back(list[rank]);
+        }
+        if (pages.size() == before) break;
+    }
+    return pages;
+}
+
+/**
+ * @description: 在后台线程中将页面读入缓冲池（预热），不等待读入完成。
+ * 最多读入缓冲池大小个页面，排在前面的页面优先；选出的页面按(fd, page_no)排序，连续的页面用一次向量读读入，
+ * 已在缓冲池中的页面被跳过。正在进行的预热会先被取消
+ * @param {vector<PageId>} pages 要读入的页面，一般为get_resident_pages在上次关闭数据库时的结果
+ */
+void BufferPoolManager::warm_up(std::vector<PageId> pages) {
+    stop_warm_up();
+    if (pages.size() > pool_size_) pages.resize(pool_size_);
+    std::sort(pages.begin(), pages.end(), [](const PageId &a, const PageId &b) {
+        return a.fd != b.fd ? a.fd < b.fd : a.page_no < b.page_no;
+    });
+    warm_up_cancelled_ = false;
+    warm_up_thread_ = std::thread([this, pages = std::move(pages)] {
+        size_t i = 0;
+        while (i < pages.size() && !warm_up_cancelled_.load()) {
+            size_t j = i + 1;
+            while (j < pages.size() && j - i < WARM_UP_RUN_PAGES && pages[j].fd == pages[i].fd &&
+                   pages[j].page_no == pages[j - 1].page_no + 1) {
+                j++;
             }
+            do_prefetch({pages[i], static_cast<int>(j - i), nullptr});
+            i = j;
         }
+    });
+}
+
+/**
+ * @description: 等待预热线程结束，关闭预热的文件之前必须调用
+ * @param {bool} cancel 是否放弃尚未读入的页面，为false时等待全部页面读入
+ */
+void BufferPoolManager::stop_warm_up(bool cancel) {
+    if (!warm_up_thread_.joinable()) return;
+    if (cancel) warm_up_cancelled_ = true;
+    warm_up_thread_.join();
+}
+
+/**
+ * @description: 停止预读线程，尚未执行的预读请求被丢弃
+ */
+void BufferPoolManager::stop_prefetcher() {
+    {
+        std::scoped_lock lock{prefetch_latch_};
+        if (!prefetch_running_) return;
+        prefetch_running_ = false;
+        prefetch_queue_.clear();
     }
-}
\ No newline at end of file
+    prefetch_cv_.notify_all();
+    prefetch_thread_.join();
+}
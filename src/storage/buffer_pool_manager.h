@@ -13,71 +13,162 @@ See the Mulan PSL v2 for more details. */
 #include <unistd.h>
 
 #include <cassert>
-#include <list>
-#include <unordered_map>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include "async_io.h"
+#include "buffer_access_strategy.h"
+#include "buffer_pool_instance.h"
+#include "page_guard.h"
 #include "disk_manager.h"
+#include "frame_arena.h"
 #include "errors.h"
 #include "page.h"
-#include "replacer/lru_replacer.h"
-#include "replacer/replacer.h"
 
+/**
+ * @description: 分区缓冲池。内部持有若干个相互独立的BufferPoolInstance，
+ * 根据PageId的哈希值选择页面所属的分区，对外接口与单一缓冲池保持一致
+ */
 class BufferPoolManager {
    private:
-    size_t pool_size_;      // buffer_pool中可容纳页面的个数，即帧的个数
-    Page *pages_;           // buffer_pool中的Page对象数组，在构造空间中申请内存空间，在析构函数中释放，大小为BUFFER_POOL_SIZE
-    std::unordered_map<PageId, frame_id_t, PageIdHash> page_table_; // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号
-    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+    size_t pool_size_;      // buffer_pool中可容纳页面的个数，即所有分区帧的个数之和
     DiskManager *disk_manager_;
-    Replacer *replacer_;    // buffer_pool的置换策略，当前赛题中为LRU置换策略
-    std::mutex latch_;      // 用于共享数据结构的并发控制
+    FrameArena arena_;      // 所有帧的数据区，按帧号依次分给各个分区
+    std::vector<std::unique_ptr<BufferPoolInstance>> instances_;    // 缓冲池的各个分区
+
+    static constexpr int ALLOC_LATCH_NUM = 64;
+    std::mutex alloc_latches_[ALLOC_LATCH_NUM];     // 按fd分段的锁，用于串行化同一文件的new_page
+
+    std::thread cleaner_thread_;            // 后台写线程
+    std::mutex cleaner_latch_;              // 用于唤醒和停止后台写线程
+    std::condition_variable cleaner_cv_;
+    bool cleaner_running_ = false;          // 由cleaner_latch_保护
+
+    // 一次预读请求：从start开始的num_pages个连续页面
+    struct PrefetchRequest {
+        PageId start;
+        int num_pages;
+        std::shared_ptr<BufferAccessStrategy> strategy;
+    };
+    std::thread prefetch_thread_;           // 预读线程，第一次预读时启动
+    std::mutex prefetch_latch_;             // 保护预读队列
+    std::condition_variable prefetch_cv_;
+    std::deque<PrefetchRequest> prefetch_queue_;
+    bool prefetch_running_ = false;         // 由prefetch_latch_保护
+
+    std::thread warm_up_thread_;            // 预热线程，由warm_up启动
+    std::atomic<bool> warm_up_cancelled_{false};
+
+    int scan_readahead_pages_;              // 顺序扫描的预读窗口
 
    public:
-    BufferPoolManager(size_t pool_size, DiskManager *disk_manager)
-        : pool_size_(pool_size), disk_manager_(disk_manager) {
-        // 为buffer pool分配一块连续的内存空间
-        pages_ = new Page[pool_size_];
-        // 可以被Replacer改变
-        if (REPLACER_TYPE.compare("LRU"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else if (REPLACER_TYPE.compare("CLOCK"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else {
-            replacer_ = new LRUReplacer(pool_size_);
-        }
-        // 初始化时，所有的page都在free_list_中
-        for (size_t i = 0; i < pool_size_; ++i) {
-            free_list_.emplace_back(static_cast<frame_id_t>(i));  // static_cast转换数据类型
-        }
-    }
+    /**
+     * @param {size_t} pool_size 缓冲池的总帧数
+     * @param {DiskManager*} disk_manager
+     * @param {size_t} num_instances 分区个数，为0时根据pool_size自动确定
+     * @param {string&} replacer_type 置换策略，默认为REPLACER_TYPE，可在启动时通过环境变量RMDB_REPLACER指定
+     */
+    BufferPoolManager(size_t pool_size, DiskManager *disk_manager, size_t num_instances = 0,
+                      const std::string &replacer_type = get_config("REPLACER", REPLACER_TYPE));
 
     ~BufferPoolManager() {
-        delete[] pages_;
-        delete replacer_;
+        stop_warm_up();
+        stop_page_cleaner();
+        stop_prefetcher();
     }
 
     /**
-     * @description: 将目标页面标记为脏页
+     * @description: 将目标页面标记为脏页，调用者需pin住该页面，页面在unpin时加入所在文件的脏页集合
      * @param {Page*} page 脏页
      */
     static void mark_dirty(Page* page) { page->is_dirty_ = true; }
 
-   public: 
+    size_t get_pool_size() const { return pool_size_; }
+
+    size_t get_num_instances() const { return instances_.size(); }
+
+    const FrameArena &get_arena() const { return arena_; }
+
+    /**
+     * @description: 顺序扫描每次预读的页面个数，为0时不预读。默认由环境变量RMDB_SCAN_READAHEAD在创建缓冲池时指定
+     */
+    int get_scan_readahead() const { return scan_readahead_pages_; }
+
+    void set_scan_readahead(int pages) { scan_readahead_pages_ = pages; }
+
+    /**
+     * @description: 所有分区中fetch_page命中缓冲池的总次数
+     */
+    uint64_t get_hit_count() const;
+
+    /**
+     * @description: 所有分区中fetch_page需要从磁盘读入页面的总次数
+     */
+    uint64_t get_miss_count() const;
+
+    /**
+     * @description: 前台线程在替换页面时仍需自己写回脏页的总次数
+     */
+    uint64_t get_foreground_write_count() const;
+
+    /**
+     * @description: 后台写线程写回脏页的总次数
+     */
+    uint64_t get_background_write_count() const;
+
+    void start_page_cleaner(size_t target_clean = PAGE_CLEANER_TARGET_CLEAN,
+                            std::chrono::milliseconds interval = PAGE_CLEANER_INTERVAL);
+
+    void stop_page_cleaner();
+
+    void clean_pages(size_t target_clean, size_t max_pages, AsyncIOEngine *engine = nullptr);
+
+    void prefetch_pages(PageId start, int num_pages, std::shared_ptr<BufferAccessStrategy> strategy = nullptr);
+
+    std::vector<PageId> get_resident_pages();
+
+    void warm_up(std::vector<PageId> pages);
+
+    void stop_warm_up(bool cancel = true);
+
+   public:
     Page* fetch_page(PageId page_id);
 
+    Page* fetch_page(PageId page_id, BufferAccessStrategy *strategy);
+
     bool unpin_page(PageId page_id, bool is_dirty);
 
     bool flush_page(PageId page_id);
 
     Page* new_page(PageId* page_id);
 
+    Page* new_page(PageId* page_id, BufferAccessStrategy *strategy);
+
     bool delete_page(PageId page_id);
 
     void flush_all_pages(int fd);
 
+    ReadPageGuard fetch_page_read(PageId page_id, BufferAccessStrategy *strategy = nullptr);
+
+    WritePageGuard fetch_page_write(PageId page_id);
+
+    WritePageGuard new_page_write(PageId* page_id);
+
    private:
-    bool find_victim_page(frame_id_t* frame_id);
+    size_t get_instance_idx(const PageId &page_id);
+
+    BufferPoolInstance* get_instance(const PageId &page_id) { return instances_[get_instance_idx(page_id)].get(); }
+
+    BufferRing* get_ring(BufferAccessStrategy *strategy, size_t instance_idx);
+
+    void do_prefetch(const PrefetchRequest &request);
+
+    void write_back_pages(int fd, const std::vector<Page*> &pages);
 
-    // void update_page(Page* page, PageId new_page_id, frame_id_t new_frame_id);
+    void stop_prefetcher();
 };
\ No newline at end of file
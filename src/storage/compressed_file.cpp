@@ -0,0 +1,232 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "storage/compressed_file.h"
+
+#include <fcntl.h>     // for open
+#include <string.h>    // for memcpy
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for pread
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "errors.h"
+#include "lz4.h"
+
+CompressedFile::CompressedFile(int fd, const std::string &map_path) : fd_(fd) {
+    map_fd_ = ::open(map_path.c_str(), O_RDWR);
+    if (map_fd_ < 0) throw UnixError();
+    struct stat st;
+    if (fstat(map_fd_, &st) < 0) {
+        ::close(map_fd_);
+        throw UnixError();
+    }
+    entries_.resize(st.st_size / sizeof(SlotEntry));
+    size_t bytes = entries_.size() * sizeof(SlotEntry);
+    if (bytes > 0 && pread(map_fd_, entries_.data(), bytes, 0) != static_cast<ssize_t>(bytes)) {
+        ::close(map_fd_);
+        throw UnixError();
+    }
+
+    // 映射表只记录在用的槽位，槽位之间的空隙就是空闲空间，按页面大小切分后放入空闲列表
+    std::vector<std::pair<uint32_t, uint32_t>> used;
+    for (auto &entry : entries_) {
+        if (entry.length != 0) used.emplace_back(entry.sector, entry.num_sectors);
+    }
+    std::sort(used.begin(), used.end());
+    for (auto &[sector, num_sectors] : used) {
+        while (end_sector_ < sector) {
+            uint32_t n = std::min<uint32_t>(sector - end_sector_, SECTORS_PER_PAGE);
+            free_slots_[n].push_back(end_sector_);
+            end_sector_ += n;
+        }
+        end_sector_ = std::max(end_sector_, sector + num_sectors);
+    }
+}
+
+CompressedFile::~CompressedFile() {
+    if (map_fd_ >= 0) ::close(map_fd_);
+}
+
+void CompressedFile::close() {
+    std::scoped_lock lock{latch_};
+    if (map_fd_ >= 0) ::close(map_fd_);
+    map_fd_ = -1;
+    std::vector<SlotEntry>().swap(entries_);
+    for (auto &slots : free_slots_) std::vector<uint32_t>().swap(slots);
+}
+
+/**
+ * @description: 读取页面中的部分数据
+ * @param {page_id_t} page_no 页面编号
+ * @param {char} *offset 读取的内容写入到offset中
+ * @param {int} num_bytes 读取的数据量大小，不超过PAGE_SIZE
+ */
+void CompressedFile::read_page(page_id_t page_no, char *offset, int num_bytes) {
+    char page[PAGE_SIZE];
+    char *dst = num_bytes == PAGE_SIZE ? offset : page;
+    {
+        std::shared_lock lock{latch_};
+        // 槽位释放后可能被其他页面重用，读取需要在锁内完成
+        read_entry_locked(get_entry_locked(page_no), dst);
+    }
+    if (dst != offset) memcpy(offset, dst, num_bytes);
+}
+
+void CompressedFile::read_pages(page_id_t start_page_no, char **bufs, int num_pages) {
+    std::shared_lock lock{latch_};
+    uint32_t first = UINT32_MAX;
+    uint32_t last = 0;
+    for (int i = 0; i < num_pages; i++) {
+        const SlotEntry &entry = get_entry_locked(start_page_no + i);
+        first = std::min(first, entry.sector);
+        last = std::max(last, entry.sector + entry.num_sectors);
+    }
+    // 页面按顺序写入时槽位通常相邻；槽位分散时逐页读取，避免读入大量无关的扇区
+    if (num_pages == 0 || last - first > static_cast<uint32_t>(num_pages) * SECTORS_PER_PAGE) {
+        for (int i = 0; i < num_pages; i++) read_entry_locked(entries_[start_page_no + i], bufs[i]);
+        return;
+    }
+    size_t bytes = static_cast<size_t>(last - first) * COMPRESSED_SECTOR_SIZE;
+    std::vector<char> buf(bytes);
+    if (pread(fd_, buf.data(), bytes, static_cast<off_t>(first) * COMPRESSED_SECTOR_SIZE) !=
+        static_cast<ssize_t>(bytes)) {
+        throw InternalError("DiskManager::read_page Error");
+    }
+    for (int i = 0; i < num_pages; i++) {
+        const SlotEntry &entry = entries_[start_page_no + i];
+        decode(entry, buf.data() + static_cast<size_t>(entry.sector - first) * COMPRESSED_SECTOR_SIZE, bufs[i]);
+    }
+}
+
+/**
+ * @description: 获得页面的映射表项，调用者持有latch_。与读取文件末尾之后的页面一致，读取没有写过的页面视为错误
+ */
+const CompressedFile::SlotEntry &CompressedFile::get_entry_locked(page_id_t page_no) {
+    if (page_no < 0 || static_cast<size_t>(page_no) >= entries_.size() || entries_[page_no].length == 0) {
+        throw InternalError("DiskManager::read_page Error");
+    }
+    return entries_[page_no];
+}
+
+/**
+ * @description: 读取槽位中的数据并解压到page中，调用者持有latch_
+ */
+void CompressedFile::read_entry_locked(const SlotEntry &entry, char *page) {
+    off_t pos = static_cast<off_t>(entry.sector) * COMPRESSED_SECTOR_SIZE;
+    if (entry.length == PAGE_SIZE) {
+        if (pread(fd_, page, PAGE_SIZE, pos) != PAGE_SIZE) throw InternalError("DiskManager::read_page Error");
+        return;
+    }
+    char buf[PAGE_SIZE];
+    if (pread(fd_, buf, entry.length, pos) != entry.length) throw InternalError("DiskManager::read_page Error");
+    decode(entry, buf, page);
+}
+
+/**
+ * @description: 将槽位中的数据还原为页面
+ * @param {SlotEntry&} entry 槽位
+ * @param {char*} data 槽位中的数据，至少entry.length字节
+ * @param {char*} page 还原的页面写入page中
+ */
+void CompressedFile::decode(const SlotEntry &entry, const char *data, char *page) {
+    if (entry.length == PAGE_SIZE) {
+        memcpy(page, data, PAGE_SIZE);
+    } else if (LZ4_decompress_safe(data, page, entry.length, PAGE_SIZE) != PAGE_SIZE) {
+        throw InternalError("CompressedFile::read_page: corrupted compressed page");
+    }
+}
+
+/**
+ * @description: 压缩页面并写入槽位，只写页面开头的一部分时先读出页面的其余部分
+ * @param {page_id_t} page_no 页面编号
+ * @param {char} *offset 要写入的数据
+ * @param {int} num_bytes 要写入的数据大小，不超过PAGE_SIZE
+ */
+void CompressedFile::write_page(page_id_t page_no, const char *offset, int num_bytes) {
+    if (page_no < 0) throw InternalError("DiskManager::write_page Error");
+    char page[PAGE_SIZE];
+    char compressed[LZ4_COMPRESSBOUND(PAGE_SIZE)];
+    if (num_bytes == PAGE_SIZE) {
+        // 完整页面的压缩不需要持有锁
+        int length = LZ4_compress_default(offset, compressed, PAGE_SIZE, PAGE_SIZE - COMPRESSED_SECTOR_SIZE);
+        std::scoped_lock lock{latch_};
+        write_slot(page_no, length > 0 ? compressed : offset, length > 0 ? length : PAGE_SIZE);
+        return;
+    }
+
+    std::scoped_lock lock{latch_};
+    if (static_cast<size_t>(page_no) < entries_.size() && entries_[page_no].length != 0) {
+        read_entry_locked(entries_[page_no], page);
+    } else {
+        memset(page, 0, PAGE_SIZE);
+    }
+    memcpy(page, offset, num_bytes);
+    int length = LZ4_compress_default(page, compressed, PAGE_SIZE, PAGE_SIZE - COMPRESSED_SECTOR_SIZE);
+    write_slot(page_no, length > 0 ? compressed : page, length > 0 ? length : PAGE_SIZE);
+}
+
+/**
+ * @description: 将压缩后的页面写入槽位并更新映射表，调用者持有latch_的写锁。
+ * 页面总是写入新的槽位，映射表更新之后才释放原槽位，写到一半时崩溃不会破坏映射表指向的数据
+ * @param {page_id_t} page_no 页面编号
+ * @param {char*} data 压缩后的数据，length为PAGE_SIZE时为原始页面
+ * @param {int} length 数据的字节数
+ */
+void CompressedFile::write_slot(page_id_t page_no, const char *data, int length) {
+    if (map_fd_ < 0) throw InternalError("DiskManager::write_page Error");
+    int num_sectors = (length + COMPRESSED_SECTOR_SIZE - 1) / COMPRESSED_SECTOR_SIZE;
+    if (static_cast<size_t>(page_no) >= entries_.size()) entries_.resize(page_no + 1);
+    SlotEntry old = entries_[page_no];
+    SlotEntry entry;
+    entry.sector = allocate_slot(num_sectors);
+    entry.num_sectors = num_sectors;
+    entry.length = length;
+
+    // 写满整个扇区，使文件中的槽位始终按扇区对齐
+    char buf[PAGE_SIZE];
+    memcpy(buf, data, length);
+    memset(buf + length, 0, num_sectors * COMPRESSED_SECTOR_SIZE - length);
+    off_t pos = static_cast<off_t>(entry.sector) * COMPRESSED_SECTOR_SIZE;
+    if (pwrite(fd_, buf, num_sectors * COMPRESSED_SECTOR_SIZE, pos) != num_sectors * COMPRESSED_SECTOR_SIZE ||
+        pwrite(map_fd_, &entry, sizeof(entry), static_cast<off_t>(page_no) * sizeof(SlotEntry)) !=
+            static_cast<ssize_t>(sizeof(entry))) {
+        free_slots_[entry.num_sectors].push_back(entry.sector);
+        throw InternalError("DiskManager::write_page Error");
+    }
+    entries_[page_no] = entry;
+    if (old.length != 0) {
+        free_slots_[old.num_sectors].push_back(old.sector);
+    }
+}
+
+/**
+ * @description: 分配num_sectors个连续的扇区，优先使用大小相同的空闲槽位，其次切分更大的空闲槽位，最后追加到文件末尾
+ * @return {uint32_t} 第一个扇区
+ */
+uint32_t CompressedFile::allocate_slot(int num_sectors) {
+    for (int n = num_sectors; n <= SECTORS_PER_PAGE; n++) {
+        if (free_slots_[n].empty()) continue;
+        uint32_t sector = free_slots_[n].back();
+        free_slots_[n].pop_back();
+        if (n > num_sectors) free_slots_[n - num_sectors].push_back(sector + num_sectors);
+        return sector;
+    }
+    uint32_t sector = end_sector_;
+    end_sector_ += num_sectors;
+    return sector;
+}
+
+size_t CompressedFile::get_stored_bytes() {
+    std::shared_lock lock{latch_};
+    return static_cast<size_t>(end_sector_) * COMPRESSED_SECTOR_SIZE;
+}
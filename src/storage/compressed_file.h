@@ -0,0 +1,82 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * @description: 压缩存储的数据文件。缓冲池中的页面保持不压缩，写回时压缩成若干个COMPRESSED_SECTOR_SIZE大小的扇区，
+ * 存放在数据文件中的变长槽位里；页面编号到槽位的映射表保存在<数据文件><PAGE_MAP_SUFFIX>中，每个页面一项。
+ * 压缩后不能节省扇区的页面原样存放。压缩文件总是通过pread/pwrite直接读写，不经过DiskBackend
+ */
+class CompressedFile {
+   public:
+    static constexpr int SECTORS_PER_PAGE = PAGE_SIZE / COMPRESSED_SECTOR_SIZE;
+
+    /**
+     * @description: 读入映射表并重建空闲槽位，失败时抛出UnixError
+     * @param {int} fd 已打开的数据文件的句柄，由调用者关闭
+     * @param {string&} map_path 映射表文件的路径，文件一定存在
+     */
+    CompressedFile(int fd, const std::string &map_path);
+
+    ~CompressedFile();
+
+    /**
+     * @description: 等待正在进行的读写完成后关闭映射表文件，之后的读写抛出InternalError
+     */
+    void close();
+
+    void read_page(page_id_t page_no, char *offset, int num_bytes);
+
+    void write_page(page_id_t page_no, const char *offset, int num_bytes);
+
+    /**
+     * @description: 读取连续的多个完整页面，槽位在文件中相邻时使用一次pread
+     */
+    void read_pages(page_id_t start_page_no, char **bufs, int num_pages);
+
+    /**
+     * @description: 数据文件中已经使用（包括空闲槽位）的字节数
+     */
+    size_t get_stored_bytes();
+
+   private:
+    /** 映射表中的一项，length为0表示页面还没有写过 */
+    struct SlotEntry {
+        uint32_t sector = 0;       // 槽位的第一个扇区
+        uint16_t num_sectors = 0;  // 槽位的扇区个数
+        uint16_t length = 0;       // 压缩后的字节数，等于PAGE_SIZE时页面原样存放
+    };
+
+    void write_slot(page_id_t page_no, const char *data, int length);
+
+    uint32_t allocate_slot(int num_sectors);
+
+    void read_entry_locked(const SlotEntry &entry, char *page);
+
+    const SlotEntry &get_entry_locked(page_id_t page_no);
+
+    static void decode(const SlotEntry &entry, const char *data, char *page);
+
+    int fd_;
+    int map_fd_;
+    std::shared_mutex latch_;                      // 读页面加读锁，写页面（可能移动槽位）加写锁
+    std::vector<SlotEntry> entries_;               // 页面编号到槽位的映射
+    std::vector<uint32_t> free_slots_[SECTORS_PER_PAGE + 1];  // 按扇区个数分类的空闲槽位
+    uint32_t end_sector_ = 0;                      // 数据文件中已使用的扇区个数
+};
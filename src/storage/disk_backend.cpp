@@ -0,0 +1,333 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "storage/disk_backend.h"
+
+#include <fcntl.h>     // for open, fallocate
+#include <sys/uio.h>   // for preadv, pwritev
+#include <unistd.h>    // for pread, pwrite
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <climits>     // for IOV_MAX
+#include <cstdlib>     // for aligned_alloc
+#include <cstring>
+#include <thread>
+
+#include "errors.h"
+
+std::unique_ptr<DiskBackend> DiskBackend::create(const std::string &type) {
+    std::unique_ptr<DiskBackend> backend;
+    if (type == "MEMORY") {
+        backend = std::make_unique<MemoryDiskBackend>();
+    } else if (type == "POSIX") {
+        backend = std::make_unique<PosixDiskBackend>();
+    } else {
+        throw InternalError("DiskBackend::create: unknown disk backend " + type);
+    }
+    long read_latency = get_config_int("DISK_READ_LATENCY_US", 0, 0, MAX_DISK_LATENCY_US);
+    long write_latency = get_config_int("DISK_WRITE_LATENCY_US", 0, 0, MAX_DISK_LATENCY_US);
+    size_t bandwidth = get_config_int("DISK_BANDWIDTH_MB", 0, 0, MAX_DISK_BANDWIDTH_MB) * 1024 * 1024;
+    if (read_latency > 0 || write_latency > 0 || bandwidth > 0) {
+        backend = std::make_unique<LatencyDiskBackend>(std::move(backend), std::chrono::microseconds(read_latency),
+                                                       std::chrono::microseconds(write_latency), bandwidth);
+    }
+    return backend;
+}
+
+int DiskBackend::open_file(const std::string &path, __attribute__((unused)) bool direct) {
+    int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) {
+        if (errno == ENOENT) throw FileNotFoundError(path);
+        throw UnixError();
+    }
+    if (fd >= MAX_FD) {
+        ::close(fd);
+        throw InternalError("DiskBackend::open_file: too many open files");
+    }
+    return fd;
+}
+
+void DiskBackend::close_file(int fd) {
+    if (::close(fd) < 0) throw UnixError();
+}
+
+void DiskBackend::read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) {
+    for (int i = 0; i < num_pages; i++) {
+        read_page(fd, start_page_no + i, bufs[i], PAGE_SIZE);
+    }
+}
+
+void DiskBackend::write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) {
+    for (int i = 0; i < num_pages; i++) {
+        write_page(fd, start_page_no + i, bufs[i], PAGE_SIZE);
+    }
+}
+
+/* ------------------------------------------------------------------ posix */
+
+/**
+ * @description: 对文件中连续的一段区域进行向量读写，单次调用的iovec个数受IOV_MAX限制，
+ * 读写的字节数也可能不足，因此需要循环调用
+ * @param {bool} is_write 为true时使用pwritev，否则使用preadv
+ */
+static void transfer_pages(int fd, off_t pos, std::vector<struct iovec> &iov, bool is_write) {
+    size_t done = 0;
+    size_t total = 0;
+    for (auto &vec : iov) {
+        total += vec.iov_len;
+    }
+    int num_iov = static_cast<int>(iov.size());
+    int first = 0;
+    while (done < total) {
+        int cnt = std::min<int>(num_iov - first, IOV_MAX);
+        ssize_t n = is_write ? pwritev(fd, &iov[first], cnt, pos + static_cast<off_t>(done))
+                             : preadv(fd, &iov[first], cnt, pos + static_cast<off_t>(done));
+        if (n <= 0) throw InternalError(is_write ? "DiskManager::write_pages Error" : "DiskManager::read_pages Error");
+        done += n;
+        // 跳过已经完成的iovec，并调整完成了一部分的iovec
+        while (first < num_iov && static_cast<size_t>(n) >= iov[first].iov_len) {
+            n -= iov[first].iov_len;
+            first++;
+        }
+        if (n > 0) {
+            iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + n;
+            iov[first].iov_len -= n;
+        }
+    }
+}
+
+/**
+ * @description: O_DIRECT要求缓冲区地址、长度和文件偏移量都按块对齐，这里统一按PAGE_SIZE对齐
+ */
+static bool is_direct_aligned(const void *buf, size_t num_bytes) {
+    return reinterpret_cast<uintptr_t>(buf) % PAGE_SIZE == 0 && num_bytes % PAGE_SIZE == 0;
+}
+
+/**
+ * @description: 当前线程的对齐中转缓冲区，用于以O_DIRECT读写不对齐的缓冲区（如文件头）
+ */
+static char *bounce_buffer() {
+    static thread_local std::unique_ptr<char, decltype(&free)> buf(
+        static_cast<char *>(aligned_alloc(PAGE_SIZE, PAGE_SIZE)), &free);
+    return buf.get();
+}
+
+int PosixDiskBackend::open_file(const std::string &path, bool direct) {
+    int fd = ::open(path.c_str(), O_RDWR | (direct ? O_DIRECT : 0));
+    if (fd < 0 && direct && errno == EINVAL) {
+        // 文件系统不支持O_DIRECT（如tmpfs）
+        direct = false;
+        fd = ::open(path.c_str(), O_RDWR);
+    }
+    if (fd < 0) {
+        if (errno == ENOENT) throw FileNotFoundError(path);
+        throw UnixError();
+    }
+    if (fd >= MAX_FD) {
+        ::close(fd);
+        throw InternalError("DiskBackend::open_file: too many open files");
+    }
+    fd_direct_[fd] = direct;
+    return fd;
+}
+
+void PosixDiskBackend::write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) {
+    // 缓冲池分区后多个线程会同时读写同一文件，使用pwrite()避免lseek()+write()共享文件偏移量带来的竞争
+    off_t pos = static_cast<off_t>(page_no) * PAGE_SIZE;
+    if (fd_direct_[fd] && !is_direct_aligned(offset, num_bytes)) {
+        // 只写页面的一部分时需要先读出整个页面，修改后再整页写回
+        assert(num_bytes <= PAGE_SIZE);
+        char *buf = bounce_buffer();
+        ssize_t n = pread(fd, buf, PAGE_SIZE, pos);
+        if (n < 0) throw InternalError("DiskManager::write_page Error");
+        memset(buf + n, 0, PAGE_SIZE - n);
+        memcpy(buf, offset, num_bytes);
+        if (pwrite(fd, buf, PAGE_SIZE, pos) != PAGE_SIZE) throw InternalError("DiskManager::write_page Error");
+        return;
+    }
+    ssize_t n = pwrite(fd, offset, num_bytes, pos);
+    if (n != num_bytes) throw InternalError("DiskManager::write_page Error");
+}
+
+void PosixDiskBackend::read_page(int fd, page_id_t page_no, char *offset, int num_bytes) {
+    // 同write_page，使用pread()定位并读取，不改变文件偏移量
+    off_t pos = static_cast<off_t>(page_no) * PAGE_SIZE;
+    if (fd_direct_[fd] && !is_direct_aligned(offset, num_bytes)) {
+        assert(num_bytes <= PAGE_SIZE);
+        char *buf = bounce_buffer();
+        ssize_t n = pread(fd, buf, PAGE_SIZE, pos);
+        if (n < num_bytes) throw InternalError("DiskManager::read_page Error");
+        memcpy(offset, buf, num_bytes);
+        return;
+    }
+    ssize_t n = pread(fd, offset, num_bytes, pos);
+    if (n != num_bytes) throw InternalError("DiskManager::read_page Error");
+}
+
+void PosixDiskBackend::read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) {
+    if (fd_direct_[fd] && !std::all_of(bufs, bufs + num_pages, [](char *buf) { return is_direct_aligned(buf, 0); })) {
+        DiskBackend::read_pages(fd, start_page_no, bufs, num_pages);
+        return;
+    }
+    std::vector<struct iovec> iov(num_pages);
+    for (int i = 0; i < num_pages; i++) {
+        iov[i].iov_base = bufs[i];
+        iov[i].iov_len = PAGE_SIZE;
+    }
+    transfer_pages(fd, static_cast<off_t>(start_page_no) * PAGE_SIZE, iov, false);
+}
+
+void PosixDiskBackend::write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) {
+    if (fd_direct_[fd] &&
+        !std::all_of(bufs, bufs + num_pages, [](const char *buf) { return is_direct_aligned(buf, 0); })) {
+        DiskBackend::write_pages(fd, start_page_no, bufs, num_pages);
+        return;
+    }
+    std::vector<struct iovec> iov(num_pages);
+    for (int i = 0; i < num_pages; i++) {
+        iov[i].iov_base = const_cast<char *>(bufs[i]);
+        iov[i].iov_len = PAGE_SIZE;
+    }
+    transfer_pages(fd, static_cast<off_t>(start_page_no) * PAGE_SIZE, iov, true);
+}
+
+void PosixDiskBackend::reserve_pages(int fd, page_id_t start_page_no, page_id_t end_page_no) {
+    // 使用FALLOC_FL_KEEP_SIZE，文件大小（逻辑大小）仍由实际写入决定。
+    // 预留空间只是优化：文件系统不支持（EOPNOTSUPP）或空间不足时忽略，由之后的写入报告错误
+    fallocate(fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(start_page_no) * PAGE_SIZE,
+              static_cast<off_t>(end_page_no - start_page_no) * PAGE_SIZE);
+}
+
+/* ------------------------------------------------------------------ memory */
+
+int MemoryDiskBackend::open_file(const std::string &path, bool direct) {
+    int fd = DiskBackend::open_file(path, direct);
+    std::scoped_lock lock{latch_};
+    auto &file = files_[path];
+    if (file == nullptr) file = std::make_unique<MemoryFile>();
+    fd2file_[fd] = file.get();
+    return fd;
+}
+
+void MemoryDiskBackend::close_file(int fd) {
+    {
+        std::scoped_lock lock{latch_};
+        fd2file_[fd] = nullptr;
+    }
+    DiskBackend::close_file(fd);
+}
+
+void MemoryDiskBackend::destroy_file(const std::string &path) {
+    std::scoped_lock lock{latch_};
+    files_.erase(path);
+}
+
+/**
+ * @description: 获得fd对应的内存文件，第一次访问时读入磁盘文件原有的内容
+ */
+MemoryDiskBackend::MemoryFile *MemoryDiskBackend::get_file(int fd) {
+    MemoryFile *file = fd2file_[fd];
+    if (file == nullptr) throw FileNotOpenError(fd);
+    {
+        std::shared_lock lock{file->latch};
+        if (file->loaded) return file;
+    }
+    std::unique_lock lock{file->latch};
+    if (!file->loaded) {
+        while (true) {
+            auto page = std::make_unique<char[]>(PAGE_SIZE);
+            ssize_t n = pread(fd, page.get(), PAGE_SIZE, static_cast<off_t>(file->pages.size()) * PAGE_SIZE);
+            if (n < 0) throw UnixError();
+            if (n == 0) break;
+            memset(page.get() + n, 0, PAGE_SIZE - n);
+            file->pages.push_back(std::move(page));
+        }
+        file->loaded = true;
+    }
+    return file;
+}
+
+void MemoryDiskBackend::read_page(int fd, page_id_t page_no, char *offset, int num_bytes) {
+    MemoryFile *file = get_file(fd);
+    std::shared_lock lock{file->latch};
+    // 与磁盘文件一致，读取不存在的页面视为错误
+    if (page_no < 0 || static_cast<size_t>(page_no) >= file->pages.size()) {
+        throw InternalError("DiskManager::read_page Error");
+    }
+    memcpy(offset, file->pages[page_no].get(), num_bytes);
+}
+
+void MemoryDiskBackend::write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) {
+    MemoryFile *file = get_file(fd);
+    if (page_no < 0) throw InternalError("DiskManager::write_page Error");
+    {
+        // 不同线程写入的页面不同（由缓冲池保证），已有页面只需要读锁
+        std::shared_lock lock{file->latch};
+        if (static_cast<size_t>(page_no) < file->pages.size()) {
+            memcpy(file->pages[page_no].get(), offset, num_bytes);
+            return;
+        }
+    }
+    std::unique_lock lock{file->latch};
+    while (file->pages.size() <= static_cast<size_t>(page_no)) {
+        file->pages.push_back(std::make_unique<char[]>(PAGE_SIZE));  // 值初始化，内容为0
+    }
+    memcpy(file->pages[page_no].get(), offset, num_bytes);
+}
+
+/* ------------------------------------------------------------------ latency */
+
+LatencyDiskBackend::LatencyDiskBackend(std::unique_ptr<DiskBackend> inner, std::chrono::microseconds read_latency,
+                                       std::chrono::microseconds write_latency, size_t bandwidth)
+    : inner_(std::move(inner)),
+      read_latency_(read_latency),
+      write_latency_(write_latency),
+      bandwidth_(bandwidth),
+      busy_until_(std::chrono::steady_clock::now()) {}
+
+/**
+ * @description: 模拟一次请求的耗时：传输时间按带宽在所有请求之间排队，排到之后再加上固定的延迟
+ * @param {size_t} num_bytes 请求传输的字节数
+ * @param {microseconds} latency 请求的固定延迟
+ */
+void LatencyDiskBackend::delay(size_t num_bytes, std::chrono::microseconds latency) {
+    auto done = std::chrono::steady_clock::now();
+    if (bandwidth_ > 0) {
+        std::scoped_lock lock{latch_};
+        auto transfer = std::chrono::nanoseconds(static_cast<int64_t>(num_bytes * 1e9 / bandwidth_));
+        busy_until_ = std::max(busy_until_, done) + transfer;
+        done = busy_until_;
+    }
+    std::this_thread::sleep_until(done + latency);
+}
+
+void LatencyDiskBackend::read_page(int fd, page_id_t page_no, char *offset, int num_bytes) {
+    delay(num_bytes, read_latency_);
+    inner_->read_page(fd, page_no, offset, num_bytes);
+}
+
+void LatencyDiskBackend::write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) {
+    delay(num_bytes, write_latency_);
+    inner_->write_page(fd, page_no, offset, num_bytes);
+}
+
+// 连续页面的向量读写只付一次请求延迟，与真实磁盘上合并I/O的收益一致
+void LatencyDiskBackend::read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) {
+    delay(static_cast<size_t>(num_pages) * PAGE_SIZE, read_latency_);
+    inner_->read_pages(fd, start_page_no, bufs, num_pages);
+}
+
+void LatencyDiskBackend::write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) {
+    delay(static_cast<size_t>(num_pages) * PAGE_SIZE, write_latency_);
+    inner_->write_pages(fd, start_page_no, bufs, num_pages);
+}
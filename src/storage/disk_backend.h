@@ -0,0 +1,194 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * @description: 页面数据的存储后端。DiskManager负责文件的命名空间（创建、删除、打开文件及分配页号），
+ * 页面的实际读写由后端完成。fd始终是open_file打开的真实文件的句柄，用来标识文件
+ */
+class DiskBackend {
+   public:
+    static constexpr int MAX_FD = 8192;
+
+    virtual ~DiskBackend() = default;
+
+    /**
+     * @description: 打开文件，失败时抛出异常
+     * @return {int} 文件句柄
+     * @param {string&} path 文件路径，文件一定存在
+     * @param {bool} direct 是否希望绕过内核页缓存（O_DIRECT），后端可以忽略
+     */
+    virtual int open_file(const std::string &path, bool direct);
+
+    virtual void close_file(int fd);
+
+    /**
+     * @description: 文件被删除时释放后端为其保存的数据
+     */
+    virtual void destroy_file(const std::string &path) {}
+
+    virtual void read_page(int fd, page_id_t page_no, char *offset, int num_bytes) = 0;
+
+    virtual void write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) = 0;
+
+    /**
+     * @description: 读写连续的多个完整页面，默认逐页读写
+     */
+    virtual void read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages);
+
+    virtual void write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages);
+
+    /**
+     * @description: 为文件预留[start_page_no, end_page_no)范围内页面的存储空间，默认不做任何事
+     */
+    virtual void reserve_pages(int fd, page_id_t start_page_no, page_id_t end_page_no) {}
+
+    /**
+     * @description: 文件是否以O_DIRECT方式打开
+     */
+    virtual bool is_direct(int fd) const { return false; }
+
+    /**
+     * @description: 页面数据是否就存放在fd对应的文件中。为true时其他组件（如io_uring引擎）可以绕过后端直接读写fd
+     */
+    virtual bool is_native() const { return false; }
+
+    virtual const char *get_name() const = 0;
+
+    /**
+     * @description: 创建后端。type为"POSIX"时读写磁盘文件，为"MEMORY"时页面数据只保存在内存中。
+     * 环境变量RMDB_DISK_READ_LATENCY_US、RMDB_DISK_WRITE_LATENCY_US、RMDB_DISK_BANDWIDTH_MB
+     * 不为0时在外层包装一个LatencyDiskBackend
+     * @param {string&} type 默认由环境变量RMDB_DISK_BACKEND指定
+     */
+    static std::unique_ptr<DiskBackend> create(const std::string &type = get_config("DISK_BACKEND", "POSIX"));
+};
+
+/**
+ * @description: 使用pread/pwrite读写磁盘文件，支持O_DIRECT
+ */
+class PosixDiskBackend : public DiskBackend {
+   public:
+    int open_file(const std::string &path, bool direct) override;
+
+    void read_page(int fd, page_id_t page_no, char *offset, int num_bytes) override;
+
+    void write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) override;
+
+    void read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) override;
+
+    void write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) override;
+
+    void reserve_pages(int fd, page_id_t start_page_no, page_id_t end_page_no) override;
+
+    bool is_direct(int fd) const override { return fd_direct_[fd]; }
+
+    bool is_native() const override { return true; }
+
+    const char *get_name() const override { return "posix"; }
+
+   private:
+    bool fd_direct_[MAX_FD]{};  // 文件是否以O_DIRECT方式打开
+};
+
+/**
+ * @description: 页面数据只保存在内存中，用于排除文件系统影响的CPU密集型基准测试和快速测试。
+ * 文件仍在磁盘上创建和打开（用于标识文件），已有的内容在第一次读写页面时读入内存，之后的写入不会写回磁盘
+ */
+class MemoryDiskBackend : public DiskBackend {
+   public:
+    int open_file(const std::string &path, bool direct) override;
+
+    void close_file(int fd) override;
+
+    void destroy_file(const std::string &path) override;
+
+    void read_page(int fd, page_id_t page_no, char *offset, int num_bytes) override;
+
+    void write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) override;
+
+    const char *get_name() const override { return "memory"; }
+
+   private:
+    struct MemoryFile {
+        std::shared_mutex latch;                      // 页面数组扩展时加写锁，读写已有页面时加读锁
+        bool loaded = false;                          // 是否已经读入磁盘文件原有的内容
+        std::vector<std::unique_ptr<char[]>> pages;
+    };
+
+    MemoryFile *get_file(int fd);
+
+    std::mutex latch_;                                                 // 保护files_和fd2file_
+    std::unordered_map<std::string, std::unique_ptr<MemoryFile>> files_;  // 文件路径到文件内容
+    MemoryFile *fd2file_[MAX_FD]{};
+};
+
+/**
+ * @description: 包装另一个后端，为每次读写加上固定的延迟，并限制总带宽，用于在本地复现慢磁盘。
+ * 多个线程同时发出的请求延迟相互重叠，但传输时间按带宽排队，模拟一块有内部队列的磁盘
+ */
+class LatencyDiskBackend : public DiskBackend {
+   public:
+    /**
+     * @param {unique_ptr<DiskBackend>} inner 实际存储数据的后端
+     * @param {microseconds} read_latency 每次读请求的延迟
+     * @param {microseconds} write_latency 每次写请求的延迟
+     * @param {size_t} bandwidth 每秒传输的字节数，为0时不限制
+     */
+    LatencyDiskBackend(std::unique_ptr<DiskBackend> inner, std::chrono::microseconds read_latency,
+                       std::chrono::microseconds write_latency, size_t bandwidth);
+
+    int open_file(const std::string &path, bool direct) override { return inner_->open_file(path, direct); }
+
+    void close_file(int fd) override { inner_->close_file(fd); }
+
+    void destroy_file(const std::string &path) override { inner_->destroy_file(path); }
+
+    void read_page(int fd, page_id_t page_no, char *offset, int num_bytes) override;
+
+    void write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) override;
+
+    void read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) override;
+
+    void write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) override;
+
+    void reserve_pages(int fd, page_id_t start_page_no, page_id_t end_page_no) override {
+        inner_->reserve_pages(fd, start_page_no, end_page_no);
+    }
+
+    bool is_direct(int fd) const override { return inner_->is_direct(fd); }
+
+    // 直接读写fd会绕过注入的延迟
+    bool is_native() const override { return false; }
+
+    const char *get_name() const override { return "latency"; }
+
+   private:
+    void delay(size_t num_bytes, std::chrono::microseconds latency);
+
+    std::unique_ptr<DiskBackend> inner_;
+    std::chrono::microseconds read_latency_;
+    std::chrono::microseconds write_latency_;
+    size_t bandwidth_;
+    std::mutex latch_;                               // 保护busy_until_
+    std::chrono::steady_clock::time_point busy_until_;  // 已排队的传输全部完成的时刻
+};
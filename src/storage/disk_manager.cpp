@@ -12,15 +12,36 @@ See the Mulan PSL v2 for more details. */
 
 #include <assert.h>    // for assert
 #include <string.h>    // for memset
+#include <sys/mman.h>  // for mmap
 #include <sys/stat.h>  // for stat
 #include <unistd.h>    // for lseek
+#include <algorithm>
+#include <memory>
 #include <stdexcept>
 #include <execinfo.h>
 #include <iostream>
 
 #include "defs.h"
 
-DiskManager::DiskManager() { memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<page_id_t>) / sizeof(char))); }
+DiskManager::DiskManager(std::unique_ptr<DiskBackend> backend)
+    : backend_(std::move(backend)),
+      direct_io_(get_config("DIRECT_IO", "OFF") == "ON"),
+      extent_pages_(get_config_int("FILE_EXTENT_PAGES", FILE_EXTENT_PAGES, 0, MAX_EXTENT_PAGES)),
+      mmap_read_(get_config("MMAP_READ", "OFF") == "ON") {
+    memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<page_id_t>) / sizeof(char)));
+}
+
+DiskManager::~DiskManager() {
+    for (auto &mapping : retired_mappings_) {
+        if (mapping->addr != nullptr) munmap(mapping->addr, mapping->num_pages * PAGE_SIZE);
+    }
+    for (auto &slot : fd2mapping_) {
+        FileMapping *mapping = slot.load();
+        if (mapping == nullptr) continue;
+        if (mapping->addr != nullptr) munmap(mapping->addr, mapping->num_pages * PAGE_SIZE);
+        delete mapping;
+    }
+}
 
 /**
  * @description: 将数据写入文件的指定磁盘页面中
@@ -30,14 +51,14 @@ DiskManager::DiskManager() { memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<
  * @param {int} num_bytes 要写入磁盘的数据大小
  */
 void DiskManager::write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) {
-    // Todo:
-    // 1.lseek()定位到文件头，通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量
-    // 2.调用write()函数
-    // 注意write返回值与num_bytes不等时 throw InternalError("DiskManager::write_page Error");
-    off_t pos = static_cast<off_t>(page_no) * PAGE_SIZE;
-    if (lseek(fd, pos, SEEK_SET) != pos) throw InternalError("DiskManager::write_page lseek Error");
-    ssize_t n = write(fd, offset, num_bytes);
-    if (n != num_bytes) throw InternalError("DiskManager::write_page Error");
+    mark_written(fd);
+    auto start = std::chrono::steady_clock::now();
+    if (CompressedFile *compressed = get_compressed(fd)) {
+        compressed->write_page(page_no, offset, num_bytes);
+    } else {
+        backend_->write_page(fd, page_no, offset, num_bytes);
+    }
+    record_io(fd, FileIOStats::WRITE, num_bytes, start);
 }
 
 
@@ -49,14 +70,87 @@ void DiskManager::write_page(int fd, page_id_t page_no, const char *offset, int
  * @param {int} num_bytes 读取的数据量大小
  */
 void DiskManager::read_page(int fd, page_id_t page_no, char *offset, int num_bytes) {
-    // Todo:
-    // 1.lseek()定位到文件头，通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量
-    // 2.调用read()函数
-    // 注意read返回值与num_bytes不等时，throw InternalError("DiskManager::read_page Error");
-    off_t pos = static_cast<off_t>(page_no) * PAGE_SIZE;
-    if (lseek(fd, pos, SEEK_SET) != pos) throw InternalError("DiskManager::read_page lseek Error");
-    ssize_t n = read(fd, offset, num_bytes);
-    if (n != num_bytes) throw InternalError("DiskManager::read_page Error");
+    auto start = std::chrono::steady_clock::now();
+    if (CompressedFile *compressed = get_compressed(fd)) {
+        compressed->read_page(page_no, offset, num_bytes);
+    } else {
+        backend_->read_page(fd, page_no, offset, num_bytes);
+    }
+    record_io(fd, FileIOStats::READ, num_bytes, start);
+}
+
+/**
+ * @description: 读取文件中连续的多个完整页面，POSIX后端使用一次向量读(preadv)
+ * @param {int} fd 磁盘文件的文件句柄
+ * @param {page_id_t} start_page_no 第一个页面的编号
+ * @param {char**} bufs 每个页面读入的目标地址，各自需能容纳PAGE_SIZE字节
+ * @param {int} num_pages 页面个数
+ */
+void DiskManager::read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages) {
+    auto start = std::chrono::steady_clock::now();
+    if (CompressedFile *compressed = get_compressed(fd)) {
+        compressed->read_pages(start_page_no, bufs, num_pages);
+    } else {
+        backend_->read_pages(fd, start_page_no, bufs, num_pages);
+    }
+    record_io(fd, FileIOStats::READ, static_cast<uint64_t>(num_pages) * PAGE_SIZE, start);
+}
+
+/**
+ * @description: 将多个完整页面写入文件中连续的页面，POSIX后端使用一次向量写(pwritev)
+ * @param {int} fd 磁盘文件的文件句柄
+ * @param {page_id_t} start_page_no 第一个页面的编号
+ * @param {const char* const*} bufs 每个页面的数据，各自为PAGE_SIZE字节
+ * @param {int} num_pages 页面个数
+ */
+void DiskManager::write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages) {
+    mark_written(fd);
+    auto start = std::chrono::steady_clock::now();
+    if (CompressedFile *compressed = get_compressed(fd)) {
+        for (int i = 0; i < num_pages; i++) compressed->write_page(start_page_no + i, bufs[i], PAGE_SIZE);
+    } else {
+        backend_->write_pages(fd, start_page_no, bufs, num_pages);
+    }
+    record_io(fd, FileIOStats::WRITE, static_cast<uint64_t>(num_pages) * PAGE_SIZE, start);
+}
+
+/**
+ * @description: 获得页面在数据文件只读映射中的地址，第一次调用时映射整个文件。
+ * 映射使用MAP_SHARED，之后通过pwrite对文件的修改在映射中可见；但文件被写过之后就不再提供映射，
+ * 写入频繁的文件回到普通的读路径，避免缓冲池反复将映射中的内容复制回帧中
+ * @return {const char*} 页面的地址，未开启mmap读路径、文件被写过、文件压缩存储或页面超出映射范围时返回nullptr
+ * @param {int} fd 文件句柄
+ * @param {page_id_t} page_no 页面编号
+ */
+const char *DiskManager::map_page(int fd, page_id_t page_no) {
+    if (!mmap_read_ || page_no < 0 || fd_written_[fd].load(std::memory_order_relaxed) ||
+        get_compressed(fd) != nullptr) {
+        return nullptr;
+    }
+    FileMapping *mapping = fd2mapping_[fd].load(std::memory_order_acquire);
+    if (mapping == nullptr) {
+        std::scoped_lock lock{mmap_latch_};
+        mapping = fd2mapping_[fd].load(std::memory_order_acquire);
+        if (mapping == nullptr) {
+            mapping = new FileMapping();
+            struct stat st;
+            // 映射的文件需要由内核页缓存支持，O_DIRECT文件和非POSIX后端只建立空映射
+            if (backend_->is_native() && !backend_->is_direct(fd) && fstat(fd, &st) == 0 &&
+                st.st_size >= PAGE_SIZE) {
+                size_t num_pages = st.st_size / PAGE_SIZE;
+                void *addr = mmap(nullptr, num_pages * PAGE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+                if (addr != MAP_FAILED) {
+                    mapping->addr = static_cast<char *>(addr);
+                    mapping->num_pages = num_pages;
+                }
+            }
+            fd2mapping_[fd].store(mapping, std::memory_order_release);
+        }
+    }
+    if (static_cast<size_t>(page_no) >= mapping->num_pages) {
+        return nullptr;
+    }
+    return mapping->addr + static_cast<size_t>(page_no) * PAGE_SIZE;
 }
 
 /**
@@ -67,7 +161,29 @@ void DiskManager::read_page(int fd, page_id_t page_no, char *offset, int num_byt
 page_id_t DiskManager::allocate_page(int fd) {
     // 简单的自增分配策略，指定文件的页面编号加1
     assert(fd >= 0 && fd < MAX_FD);
-    return fd2pageno_[fd]++;
+    page_id_t page_no = fd2pageno_[fd]++;
+    // 压缩文件中页面的位置与页号无关，不按页号预留空间
+    if (page_no >= fd2extent_[fd] && extent_pages_ > 0 && get_compressed(fd) == nullptr) {
+        // 超出已预留的空间时，一次预留一整个extent，而不是每写一个新页面扩展一次文件
+        page_id_t end = (page_no / extent_pages_ + 1) * extent_pages_;
+        reserve_pages(fd, end);
+    }
+    return page_no;
+}
+
+/**
+ * @description: 在磁盘上为文件预留[get_extent_end(fd), end_page_no)范围内的页面（POSIX后端使用fallocate），
+ * 使之后的页面写入落在连续的extent中，并且不再需要逐页分配磁盘块。
+ * 文件大小（逻辑大小）仍由实际写入决定，读取未写入的页面与之前的行为一致
+ * @param {int} fd 文件对应的句柄
+ * @param {page_id_t} end_page_no 预留到的页面编号（不含）
+ */
+void DiskManager::reserve_pages(int fd, page_id_t end_page_no) {
+    std::lock_guard<std::mutex> lock(extent_latch_);
+    page_id_t start = fd2extent_[fd];
+    if (end_page_no <= start) return;
+    backend_->reserve_pages(fd, start, end_page_no);
+    fd2extent_[fd] = end_page_no;
 }
 
 void DiskManager::deallocate_page(__attribute__((unused)) page_id_t page_id) {}
@@ -105,16 +221,21 @@ bool DiskManager::is_file(const std::string &path) {
 
 /**
  * @description: 用于创建指定路径文件
- * @return {*}
- * @param {string} &path
+ * @param {string} &path 文件路径
+ * @param {bool} compressed 是否压缩存储文件中的页面，映射表文件存在的数据文件在打开时按压缩文件处理
  */
-void DiskManager::create_file(const std::string &path) {
+void DiskManager::create_file(const std::string &path, bool compressed) {
     int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
     if (fd < 0) {
         if (errno == EEXIST) throw FileExistsError(path);   // 已存在才抛
         throw UnixError();                                  // 其他错误
     }
     ::close(fd);   // 创建后立刻关闭
+    if (compressed) {
+        fd = ::open((path + PAGE_MAP_SUFFIX).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) throw UnixError();
+        ::close(fd);
+    }
 }
 
 /**
@@ -134,6 +255,8 @@ void DiskManager::destroy_file(const std::string &path) {
             throw FileNotFoundError(path);
         throw UnixError();
     }
+    unlink((path + PAGE_MAP_SUFFIX).c_str());     // 压缩文件的映射表，不存在时忽略
+    backend_->destroy_file(path);
 }
 
 
@@ -149,15 +272,35 @@ int DiskManager::open_file(const std::string &path) {
         throw FileNotFoundError(path);
     }
 
-    int fd = ::open(path.c_str(), O_RDWR);
-    if (fd < 0) {
-        if (errno == ENOENT) throw FileNotFoundError(path);
-        throw UnixError();
+    // 数据文件和索引文件由缓冲池缓存，可以绕过内核页缓存；日志文件保持带缓存的I/O。
+    // 压缩文件的槽位按扇区对齐，不满足O_DIRECT的要求
+    std::string map_path = path + PAGE_MAP_SUFFIX;
+    bool compressed = is_file(map_path);
+    int fd = backend_->open_file(path, direct_io_ && path != LOG_FILE_NAME && !compressed);
+    if (compressed) {
+        std::unique_ptr<CompressedFile> file;
+        try {
+            file = std::make_unique<CompressedFile>(fd, map_path);
+        } catch (...) {
+            backend_->close_file(fd);
+            throw;
+        }
+        fd2compressed_[fd].store(file.get(), std::memory_order_release);
+        std::scoped_lock lock{compressed_latch_};
+        compressed_files_.push_back(std::move(file));
+    }
+
+    if (fd2stats_[fd] == nullptr) {
+        fd2stats_[fd] = std::make_unique<FileIOStats>();
+    } else {
+        fd2stats_[fd]->reset();
     }
 
     path2fd_[path] = fd;
     fd2path_[fd]   = path;
     fd2pageno_[fd] = 0;
+    // 已有的页面不需要再预留，之后从文件末尾开始按extent预留
+    fd2extent_[fd] = (get_file_size(path) + PAGE_SIZE - 1) / PAGE_SIZE;
     return fd;
 }
 
@@ -171,7 +314,19 @@ void DiskManager::close_file(int fd) {
     // 注意不能关闭未打开的文件，并且需要更新文件打开列表
     
     if (!fd2path_.count(fd)) throw FileNotOpenError(fd);
-    if (close(fd) < 0) throw UnixError();
+    {
+        // 缓冲池中可能仍有帧指向映射，映射保留到DiskManager析构时才解除
+        std::scoped_lock lock{mmap_latch_};
+        if (FileMapping *mapping = fd2mapping_[fd].exchange(nullptr)) {
+            retired_mappings_.emplace_back(mapping);
+        }
+        fd_written_[fd] = false;
+    }
+    // 等待文件上正在进行的读写完成后关闭映射表，对象保留到DiskManager析构
+    if (CompressedFile *compressed = fd2compressed_[fd].exchange(nullptr)) {
+        compressed->close();
+    }
+    backend_->close_file(fd);
     std::string path = fd2path_[fd];
     fd2path_.erase(fd);
     path2fd_.erase(path);
@@ -189,6 +344,11 @@ int DiskManager::get_file_size(const std::string &file_name) {
     return rc == 0 ? stat_buf.st_size : -1;
 }
 
+size_t DiskManager::get_stored_bytes(int fd) {
+    if (CompressedFile *compressed = get_compressed(fd)) return compressed->get_stored_bytes();
+    return std::max(get_file_size(get_file_name(fd)), 0);
+}
+
 /**
  * @description: 根据文件句柄获得文件名
  * @return {string} 文件句柄对应文件的文件名
@@ -233,9 +393,11 @@ int DiskManager::read_log(char *log_data, int size, int offset) {
 
     size = std::min(size, file_size - offset);
     if(size == 0) return 0;
+    auto start = std::chrono::steady_clock::now();
     lseek(log_fd_, offset, SEEK_SET);
     ssize_t bytes_read = read(log_fd_, log_data, size);
     assert(bytes_read == size);
+    record_io(log_fd_, FileIOStats::READ, bytes_read, start);
     return bytes_read;
 }
 
@@ -251,9 +413,11 @@ void DiskManager::write_log(char *log_data, int size) {
     }
 
     // write from the file_end
+    auto start = std::chrono::steady_clock::now();
     lseek(log_fd_, 0, SEEK_END);
     ssize_t bytes_write = write(log_fd_, log_data, size);
     if (bytes_write != size) {
         throw UnixError();
     }
+    record_io(log_fd_, FileIOStats::WRITE, bytes_write, start);
 }
\ No newline at end of file
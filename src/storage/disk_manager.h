@@ -15,31 +15,46 @@ See the Mulan PSL v2 for more details. */
 #include <unistd.h>    
 
 #include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/config.h"
 #include "errors.h"  
+#include "storage/compressed_file.h"
+#include "storage/disk_backend.h"
+#include "storage/io_stats.h"
 
 /**
- * @description: DiskManager的作用主要是根据上层的需要对磁盘文件进行操作
+ * @description: DiskManager的作用主要是根据上层的需要对磁盘文件进行操作，页面的读写交给DiskBackend完成
  */
 class DiskManager {
    public:
-    explicit DiskManager();
+    /**
+     * @param {unique_ptr<DiskBackend>} backend 页面数据的存储后端，默认由环境变量RMDB_DISK_BACKEND指定
+     */
+    explicit DiskManager(std::unique_ptr<DiskBackend> backend = DiskBackend::create());
 
-    ~DiskManager() = default;
+    ~DiskManager();
 
     void write_page(int fd, page_id_t page_no, const char *offset, int num_bytes);
 
     void read_page(int fd, page_id_t page_no, char *offset, int num_bytes);
 
+    void read_pages(int fd, page_id_t start_page_no, char **bufs, int num_pages);
+
+    void write_pages(int fd, page_id_t start_page_no, const char *const *bufs, int num_pages);
+
     page_id_t allocate_page(int fd);
 
     void deallocate_page(page_id_t page_id);
 
+    void reserve_pages(int fd, page_id_t end_page_no);
+
     /*目录操作*/
     bool is_dir(const std::string &path);
 
@@ -50,7 +65,11 @@ class DiskManager {
     /*文件操作*/
     bool is_file(const std::string &path);
 
-    void create_file(const std::string &path);
+    /**
+     * @param {string&} path 文件路径
+     * @param {bool} compressed 是否压缩存储文件中的页面，同时创建页面映射表文件<path><PAGE_MAP_SUFFIX>
+     */
+    void create_file(const std::string &path, bool compressed = false);
 
     void destroy_file(const std::string &path);
 
@@ -71,6 +90,61 @@ class DiskManager {
 
     void SetLogFd(int log_fd) { log_fd_ = log_fd; }
 
+    /**
+     * @description: 设置之后打开的数据文件和索引文件是否使用O_DIRECT，绕过内核的页缓存。
+     * 默认由环境变量RMDB_DIRECT_IO=ON开启；日志文件总是使用带缓存的I/O
+     */
+    void set_direct_io(bool direct_io) { direct_io_ = direct_io; }
+
+    /**
+     * @description: 文件是否以O_DIRECT方式打开，文件系统不支持O_DIRECT时会退回普通I/O
+     */
+    bool is_direct(int fd) const { return backend_->is_direct(fd); }
+
+    /**
+     * @description: 页面数据是否就存放在fd对应的文件中，为false时不能绕过DiskManager直接读写fd（如使用io_uring）
+     */
+    bool is_native() const { return backend_->is_native(); }
+
+    DiskBackend *get_backend() const { return backend_.get(); }
+
+    /**
+     * @description: 文件是否压缩存储。压缩文件的页面只能通过DiskManager读写，不能直接读写fd
+     */
+    bool is_compressed(int fd) const { return get_compressed(fd) != nullptr; }
+
+    /**
+     * @description: 获得压缩文件实际占用的字节数，未压缩的文件返回文件大小
+     */
+    size_t get_stored_bytes(int fd);
+
+    /**
+     * @description: 获得文件自打开以来的I/O统计，文件从未打开过时返回nullptr。
+     * 统计对象在DiskManager析构前一直有效，fd被重新打开时清零
+     */
+    FileIOStats *get_io_stats(int fd) const { return fd2stats_[fd].get(); }
+
+    /**
+     * @description: 记录一次绕过DiskManager完成的读写（如io_uring引擎直接读写fd）
+     */
+    void record_io(int fd, FileIOStats::Kind kind, uint64_t bytes, uint64_t latency_us) {
+        if (fd2stats_[fd] != nullptr) fd2stats_[fd]->record(kind, bytes, latency_us);
+    }
+
+    /**
+     * @description: 标记文件自打开以来被写过，此后map_page不再为它提供映射。
+     * DiskManager的写接口会自动标记，绕过DiskManager直接写fd的调用者（如io_uring引擎）需要在写之前调用
+     */
+    void mark_written(int fd) { fd_written_[fd].store(true, std::memory_order_relaxed); }
+
+    /**
+     * @description: 设置是否为只读访问的页面提供数据文件的只读映射（mmap读路径），默认由环境变量RMDB_MMAP_READ=ON开启。
+     * 只对POSIX后端、未以O_DIRECT打开的文件生效
+     */
+    void set_mmap_read(bool mmap_read) { mmap_read_ = mmap_read; }
+
+    const char *map_page(int fd, page_id_t page_no);
+
     int GetLogFd() { return log_fd_; }
 
     /**
@@ -87,13 +161,57 @@ class DiskManager {
      */
     page_id_t get_fd2pageno(int fd) { return fd2pageno_[fd]; }
 
-    static constexpr int MAX_FD = 8192;
+    /**
+     * @description: 设置之后分配页面时每次预分配的磁盘空间（页面个数），为0时不预分配。
+     * 默认由环境变量RMDB_FILE_EXTENT_PAGES指定
+     */
+    void set_extent_pages(int extent_pages) { extent_pages_ = extent_pages; }
+
+    /**
+     * @description: 获得文件已经在磁盘上预留的页面个数（物理大小），不小于get_fd2pageno()分配出的页面个数（逻辑大小）
+     * @param {int} fd 文件对应的句柄
+     */
+    page_id_t get_extent_end(int fd) { return fd2extent_[fd]; }
+
+    static constexpr int MAX_FD = DiskBackend::MAX_FD;
 
    private:
     // 文件打开列表，用于记录文件是否被打开
     std::unordered_map<std::string, int> path2fd_;  //<Page文件磁盘路径,Page fd>哈希表
     std::unordered_map<int, std::string> fd2path_;  //<Page fd,Page文件磁盘路径>哈希表
 
+    std::unique_ptr<DiskBackend> backend_;          // 页面数据的存储后端
+
     int log_fd_ = -1;                             // WAL日志文件的文件句柄，默认为-1，代表未打开日志文件
     std::atomic<page_id_t> fd2pageno_[MAX_FD]{};  // 文件中已经分配的页面个数，初始值为0
+    bool direct_io_;                              // 之后打开的数据文件是否使用O_DIRECT
+    std::atomic<page_id_t> fd2extent_[MAX_FD]{};  // 文件在磁盘上已预留空间的页面个数
+    int extent_pages_;                            // 每次预分配的页面个数
+    std::mutex extent_latch_;                     // 串行化预分配，避免多个分区重复扩展同一文件
+
+    /** 数据文件的只读映射，映射后不再改变，文件关闭后才解除 */
+    struct FileMapping {
+        char *addr = nullptr;
+        size_t num_pages = 0;  // 映射中完整页面的个数
+    };
+    bool mmap_read_;                                  // 是否开启mmap读路径
+    std::mutex mmap_latch_;                           // 保护映射的建立与解除
+    std::atomic<FileMapping *> fd2mapping_[MAX_FD]{};  // 文件的映射，尚未建立时为nullptr
+    std::atomic<bool> fd_written_[MAX_FD]{};          // 打开后是否写过文件，写过的文件不再提供映射
+    std::vector<std::unique_ptr<FileMapping>> retired_mappings_;  // 已关闭文件的映射，缓冲池中可能仍有帧指向它们
+
+    // 压缩文件的槽位映射，未压缩的文件为nullptr。后台写线程和预读线程不加锁读取，打开文件时发布，
+    // 关闭时置空，对象本身保留到DiskManager析构，避免正在进行的读写访问已释放的对象
+    std::atomic<CompressedFile *> fd2compressed_[MAX_FD]{};
+    std::mutex compressed_latch_;                                    // 保护compressed_files_
+    std::vector<std::unique_ptr<CompressedFile>> compressed_files_;  // 所有打开过的压缩文件
+
+    std::unique_ptr<FileIOStats> fd2stats_[MAX_FD];  // 每个fd的I/O统计，第一次打开时创建
+
+    CompressedFile *get_compressed(int fd) const { return fd2compressed_[fd].load(std::memory_order_acquire); }
+
+    void record_io(int fd, FileIOStats::Kind kind, uint64_t bytes, std::chrono::steady_clock::time_point start) {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        record_io(fd, kind, bytes, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
 };
\ No newline at end of file
@@ -0,0 +1,42 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "frame_arena.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include "errors.h"
+
+FrameArena::FrameArena(size_t num_frames) : num_frames_(num_frames) {
+    size_t size = std::max<size_t>(num_frames, 1) * PAGE_SIZE;
+    mapped_size_ = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    void *addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    // 只有系统预留了足够的大页时才会成功
+    addr = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    hugetlb_ = addr != MAP_FAILED;
+#endif
+    if (addr == MAP_FAILED) {
+        addr = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            throw UnixError();
+        }
+#ifdef MADV_HUGEPAGE
+        // 只是建议，内核不支持透明大页时忽略错误
+        madvise(addr, mapped_size_, MADV_HUGEPAGE);
+#endif
+    }
+    base_ = static_cast<char *>(addr);
+}
+
+FrameArena::~FrameArena() { munmap(base_, mapped_size_); }
@@ -0,0 +1,52 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/config.h"
+
+/**
+ * @description: 缓冲池所有帧的数据区。所有帧的PAGE_SIZE字节数据连续存放在一块按页对齐的内存中，
+ * 帧的元数据（Page对象）另外存放，使数据区可以使用大页并满足O_DIRECT的对齐要求。
+ * 内存通过mmap申请：优先使用预留的大页(MAP_HUGETLB)，失败时使用普通页面并通过madvise(MADV_HUGEPAGE)
+ * 建议内核使用透明大页
+ */
+class FrameArena {
+   public:
+    /**
+     * @param {size_t} num_frames 帧的个数
+     */
+    explicit FrameArena(size_t num_frames);
+
+    ~FrameArena();
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    /**
+     * @description: 第frame_idx个帧的数据区，按PAGE_SIZE对齐
+     */
+    char *get_frame(size_t frame_idx) const { return base_ + frame_idx * PAGE_SIZE; }
+
+    size_t get_num_frames() const { return num_frames_; }
+
+    /**
+     * @description: 是否使用了预留的大页，为false时是否使用透明大页由内核决定
+     */
+    bool is_hugetlb() const { return hugetlb_; }
+
+   private:
+    size_t num_frames_;
+    size_t mapped_size_;    // mmap的字节数，为大页大小的整数倍
+    char *base_;
+    bool hugetlb_ = false;
+};
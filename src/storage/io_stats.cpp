@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "storage/io_stats.h"
+
+uint64_t FileIOStats::Snapshot::percentile(Kind kind, double p) const {
+    if (ops[kind] == 0) return 0;
+    uint64_t target = static_cast<uint64_t>(p * ops[kind]);
+    uint64_t seen = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        seen += latency[kind][i];
+        if (seen > target || i == NUM_BUCKETS - 1) return uint64_t{1} << i;
+    }
+    return 0;
+}
+
+FileIOStats::Snapshot FileIOStats::snapshot() const {
+    Snapshot snapshot;
+    for (const Stripe &stripe : stripes_) {
+        for (int kind = READ; kind <= WRITE; kind++) {
+            snapshot.ops[kind] += stripe.ops[kind].load(std::memory_order_relaxed);
+            snapshot.bytes[kind] += stripe.bytes[kind].load(std::memory_order_relaxed);
+            snapshot.time_us[kind] += stripe.time_us[kind].load(std::memory_order_relaxed);
+            for (int i = 0; i < NUM_BUCKETS; i++) {
+                snapshot.latency[kind][i] += stripe.latency[kind][i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return snapshot;
+}
+
+void FileIOStats::reset() {
+    for (Stripe &stripe : stripes_) {
+        for (int kind = READ; kind <= WRITE; kind++) {
+            stripe.ops[kind].store(0, std::memory_order_relaxed);
+            stripe.bytes[kind].store(0, std::memory_order_relaxed);
+            stripe.time_us[kind].store(0, std::memory_order_relaxed);
+            for (auto &count : stripe.latency[kind]) count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+int FileIOStats::get_stripe() {
+    static std::atomic<int> next_stripe{0};
+    thread_local int stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % NUM_STRIPES;
+    return stripe;
+}
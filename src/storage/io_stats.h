@@ -0,0 +1,78 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @description: 一个文件的I/O统计：读写次数、字节数、累计时间和延迟直方图。
+ * 计数按线程分散到多个缓存行对齐的条带上，记录时只对本线程条带上的计数做relaxed原子加，读取时再把各条带相加
+ */
+class FileIOStats {
+   public:
+    static constexpr int NUM_STRIPES = 16;
+    static constexpr int NUM_BUCKETS = 20;  // 第0个桶为[0, 1)us，第i个桶为[2^(i-1), 2^i)us，最后一个桶不设上限
+
+    enum Kind { READ = 0, WRITE = 1 };
+
+    /** 各条带相加后的统计 */
+    struct Snapshot {
+        uint64_t ops[2] = {};
+        uint64_t bytes[2] = {};
+        uint64_t time_us[2] = {};
+        uint64_t latency[2][NUM_BUCKETS] = {};
+
+        /**
+         * @description: 延迟的百分位数，返回所在桶的上界，没有请求时返回0
+         * @param {Kind} kind 读或写
+         * @param {double} p 百分位，例如0.99
+         */
+        uint64_t percentile(Kind kind, double p) const;
+    };
+
+    /**
+     * @description: 记录一次完成的读写
+     * @param {Kind} kind 读或写
+     * @param {uint64_t} bytes 读写的字节数
+     * @param {uint64_t} latency_us 耗时（微秒）
+     */
+    void record(Kind kind, uint64_t bytes, uint64_t latency_us) {
+        Stripe &stripe = stripes_[get_stripe()];
+        stripe.ops[kind].fetch_add(1, std::memory_order_relaxed);
+        stripe.bytes[kind].fetch_add(bytes, std::memory_order_relaxed);
+        stripe.time_us[kind].fetch_add(latency_us, std::memory_order_relaxed);
+        stripe.latency[kind][get_bucket(latency_us)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot() const;
+
+    void reset();
+
+    static int get_bucket(uint64_t latency_us) {
+        int bucket = latency_us == 0 ? 0 : 64 - __builtin_clzll(latency_us);
+        return bucket < NUM_BUCKETS ? bucket : NUM_BUCKETS - 1;
+    }
+
+   private:
+    struct alignas(64) Stripe {
+        std::atomic<uint64_t> ops[2] = {};
+        std::atomic<uint64_t> bytes[2] = {};
+        std::atomic<uint64_t> time_us[2] = {};
+        std::atomic<uint64_t> latency[2][NUM_BUCKETS] = {};
+    };
+
+    /** 线程第一次记录时按顺序分配条带 */
+    static int get_stripe();
+
+    Stripe stripes_[NUM_STRIPES];
+};
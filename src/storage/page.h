@@ -10,6 +10,11 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+
 #include "common/config.h"
 
 /**
@@ -30,13 +35,14 @@ struct PageId {
     }
 
     inline int64_t Get() const {
-        return (static_cast<int64_t>(fd << 16) | page_no);
+        return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(fd)) << 32) |
+                                    static_cast<uint32_t>(page_no));
     }
 };
 
 // PageId的自定义哈希算法, 用于构建unordered_map<PageId, frame_id_t, PageIdHash>
 struct PageIdHash {
-    size_t operator()(const PageId &x) const { return (x.fd << 16) | x.page_no; }
+    size_t operator()(const PageId &x) const { return std::hash<int64_t>()(x.Get()); }
 };
 
 template <>
@@ -50,16 +56,17 @@ struct std::hash<PageId> {
  */
 class Page {
     friend class BufferPoolManager;
+    friend class BufferPoolInstance;
 
    public:
     
-    Page() { reset_memory(); }
+    Page() = default;
 
     ~Page() = default;
 
     PageId get_page_id() const { return id_; }
 
-    inline char *get_data() { return data_; }
+    inline char *get_data() { return data_.load(std::memory_order_acquire); }
 
     bool is_dirty() const { return is_dirty_; }
 
@@ -71,20 +78,52 @@ class Page {
 
     inline void set_page_lsn(lsn_t page_lsn) { memcpy(get_data() + OFFSET_LSN, &page_lsn, sizeof(lsn_t)); }
 
+    /** 页面内容的读写锁，调用者需先pin住页面，一般通过ReadPageGuard/WritePageGuard使用 */
+    void rlatch() { rwlatch_.lock_shared(); }
+
+    void runlatch() { rwlatch_.unlock_shared(); }
+
+    void wlatch() { rwlatch_.lock(); }
+
+    void wunlatch() { rwlatch_.unlock(); }
+
    private:
-    void reset_memory() { memset(data_, OFFSET_PAGE_START, PAGE_SIZE); }  // 将data_的PAGE_SIZE个字节填充为0
+    void reset_memory() { memset(get_data(), OFFSET_PAGE_START, PAGE_SIZE); }  // 将data_的PAGE_SIZE个字节填充为0
 
     /** page的唯一标识符 */
     PageId id_;
 
     /** The actual data that is stored within a page.
-     *  该页面在bufferPool中的偏移地址
+     *  通常等于frame_；只读访问的页面可以直接指向DiskManager对数据文件的只读映射（mapped_为true）。
+     *  unmap_frame会在其他线程pin住并读取页面时改写它，因此使用原子变量
      */
-    char data_[PAGE_SIZE] = {};
+    std::atomic<char *> data_{nullptr};
+
+    /** 该帧在缓冲池数据区(FrameArena)中的地址，按PAGE_SIZE对齐，由缓冲池在初始化时设置 */
+    char *frame_ = nullptr;
+
+    /** data_指向文件的只读映射，修改页面之前需先复制回frame_ */
+    std::atomic<bool> mapped_{false};
+
+    /** 脏页判断，写回磁盘时在缓冲池latch之外被清除，因此使用原子变量 */
+    std::atomic<bool> is_dirty_{false};
+
+    /** The pin count of this page.
+     *  帧中没有页面（在空闲链表中或正被替换）时为-1，命中时在缓冲池latch之外通过CAS增加 */
+    std::atomic<int> pin_count_{0};
+
+    /** 页面正在从磁盘读入，读入完成前其他线程需在io_latch_上等待 */
+    std::atomic<bool> io_in_progress_{false};
+
+    /** 页面读入失败，帧中的数据无效 */
+    bool io_error_ = false;
+
+    /** 帧的I/O锁，读入或写回期间由执行I/O的线程持有 */
+    std::mutex io_latch_;
 
-    /** 脏页判断 */
-    bool is_dirty_ = false;
+    /** 页面由预读装入，尚未被fetch_page访问过 */
+    std::atomic<bool> prefetched_{false};
 
-    /** The pin count of this page. */
-    int pin_count_ = 0;
+    /** 页面内容的读写锁，与缓冲池的latch和io_latch_相互独立 */
+    std::shared_mutex rwlatch_;
 };
\ No newline at end of file
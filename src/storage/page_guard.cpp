@@ -0,0 +1,53 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "page_guard.h"
+
+#include "buffer_pool_manager.h"
+
+/**
+ * @description: 按指定模式对页面加锁
+ */
+void PageGuard::latch(LatchMode mode) {
+    if (page_ == nullptr) return;
+    if (mode == LatchMode::SHARED) {
+        page_->rlatch();
+    } else if (mode == LatchMode::EXCLUSIVE) {
+        page_->wlatch();
+    }
+    mode_ = mode;
+}
+
+PageGuard PageGuard::unlatch() {
+    if (mode_ == LatchMode::SHARED) {
+        page_->runlatch();
+    } else if (mode_ == LatchMode::EXCLUSIVE) {
+        page_->wunlatch();
+    }
+    mode_ = LatchMode::NONE;
+    PageGuard guard;
+    guard.move_from(*this);
+    return guard;
+}
+
+/**
+ * @description: 先释放页面锁再unpin，保证unpin之后不再有线程持有该帧的锁
+ */
+void PageGuard::release() {
+    if (page_ == nullptr) return;
+    if (mode_ == LatchMode::SHARED) {
+        page_->runlatch();
+    } else if (mode_ == LatchMode::EXCLUSIVE) {
+        page_->wunlatch();
+    }
+    bpm_->unpin_page(page_->get_page_id(), is_dirty_);
+    page_ = nullptr;
+    mode_ = LatchMode::NONE;
+}
@@ -0,0 +1,138 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "page.h"
+
+class BufferPoolManager;
+
+/**
+ * @description: 页面的RAII句柄基类，持有页面的一个pin，析构或release时自动unpin。
+ * 只能移动，不能复制
+ */
+class PageGuard {
+   public:
+    PageGuard() = default;
+
+    /**
+     * @param {BufferPoolManager*} bpm 页面所在的缓冲池
+     * @param {Page*} page 已被pin住的页面，句柄接管这个pin；为nullptr时句柄无效
+     */
+    PageGuard(BufferPoolManager *bpm, Page *page) : bpm_(bpm), page_(page) {}
+
+    PageGuard(const PageGuard &) = delete;
+    PageGuard &operator=(const PageGuard &) = delete;
+
+    PageGuard(PageGuard &&other) noexcept { move_from(other); }
+
+    PageGuard &operator=(PageGuard &&other) noexcept {
+        if (this != &other) {
+            release();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    ~PageGuard() { release(); }
+
+    /**
+     * @description: 提前释放页面，之后句柄无效
+     */
+    void release();
+
+    bool is_valid() const { return page_ != nullptr; }
+
+    Page *get_page() const { return page_; }
+
+    PageId get_page_id() const { return page_->get_page_id(); }
+
+    const char *get_data() const { return page_->get_data(); }
+
+    /**
+     * @description: 标记页面被修改过，unpin时将其标记为脏页
+     */
+    void mark_dirty() { is_dirty_ = true; }
+
+    /**
+     * @description: 释放页面锁但保留pin，返回只持有pin的句柄，之后原句柄无效
+     */
+    PageGuard unlatch();
+
+   protected:
+    enum class LatchMode { NONE, SHARED, EXCLUSIVE };
+
+    void move_from(PageGuard &other) {
+        bpm_ = other.bpm_;
+        page_ = other.page_;
+        is_dirty_ = other.is_dirty_;
+        mode_ = other.mode_;
+        other.page_ = nullptr;
+        other.mode_ = LatchMode::NONE;
+    }
+
+    void latch(LatchMode mode);
+
+    BufferPoolManager *bpm_ = nullptr;
+    Page *page_ = nullptr;
+    bool is_dirty_ = false;
+    LatchMode mode_ = LatchMode::NONE;
+};
+
+/**
+ * @description: 在作用域内对已被pin住的页面加读锁，不接管pin。用于短时间读取只持有pin的页面
+ */
+class ScopedReadLatch {
+   public:
+    explicit ScopedReadLatch(Page *page) : page_(page) {
+        if (page_ != nullptr) page_->rlatch();
+    }
+
+    ScopedReadLatch(const ScopedReadLatch &) = delete;
+    ScopedReadLatch &operator=(const ScopedReadLatch &) = delete;
+
+    ~ScopedReadLatch() {
+        if (page_ != nullptr) page_->runlatch();
+    }
+
+   private:
+    Page *page_;
+};
+
+/**
+ * @description: 持有页面读锁（共享锁）的句柄
+ */
+class ReadPageGuard : public PageGuard {
+   public:
+    ReadPageGuard() = default;
+
+    /**
+     * @description: 对已被pin住的页面加读锁，句柄接管这个pin
+     */
+    ReadPageGuard(BufferPoolManager *bpm, Page *page) : PageGuard(bpm, page) { latch(LatchMode::SHARED); }
+};
+
+/**
+ * @description: 持有页面写锁（排他锁）的句柄，释放时将页面标记为脏页
+ */
+class WritePageGuard : public PageGuard {
+   public:
+    WritePageGuard() = default;
+
+    /**
+     * @description: 对已被pin住的页面加写锁，句柄接管这个pin
+     */
+    WritePageGuard(BufferPoolManager *bpm, Page *page) : PageGuard(bpm, page) {
+        latch(LatchMode::EXCLUSIVE);
+        is_dirty_ = true;
+    }
+
+    char *get_data_mut() const { return page_->get_data(); }
+};
@@ -0,0 +1,159 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+#include "page_table.h"
+
+#include <cassert>
+
+PageTable::PageTable(size_t num_frames) : num_frames_(num_frames) {
+    // 装载因子不超过1/2，保证无锁查找的探测序列较短
+    capacity_ = 16;
+    while (capacity_ < num_frames * 2) {
+        capacity_ <<= 1;
+    }
+    mask_ = capacity_ - 1;
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    scratch_ = std::make_unique<std::pair<uint64_t, frame_id_t>[]>(num_frames);
+}
+
+/**
+ * @description: 计算key的起始槽位。BufferPoolManager使用乘法哈希的高位选择分区，
+ * 这里使用另一个混合函数，避免同一分区内的页面集中在少数槽位上
+ */
+size_t PageTable::slot_of(uint64_t key) const {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key & mask_;
+}
+
+bool PageTable::find(const PageId &page_id, frame_id_t *frame_id) const {
+    uint64_t key = pack(page_id);
+    while (true) {
+        uint64_t version = version_.load(std::memory_order_acquire);
+        if (version & 1) {
+            continue;
+        }
+        frame_id_t result;
+        bool found = probe(key, &result);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (version_.load(std::memory_order_relaxed) == version) {
+            *frame_id = result;
+            return found;
+        }
+    }
+}
+
+/**
+ * @description: 沿探测序列查找key
+ */
+bool PageTable::probe(uint64_t key, frame_id_t *frame_id) const {
+    size_t idx = slot_of(key);
+    for (size_t n = 0; n < capacity_; n++, idx = (idx + 1) & mask_) {
+        uint64_t slot_key = slots_[idx].key.load(std::memory_order_acquire);
+        if (slot_key == key) {
+            *frame_id = slots_[idx].frame_id.load(std::memory_order_relaxed);
+            return true;
+        }
+        if (slot_key == EMPTY_KEY) {
+            return false;
+        }
+    }
+    return false;
+}
+
+void PageTable::insert(const PageId &page_id, frame_id_t frame_id) {
+    uint64_t key = pack(page_id);
+    size_t idx = slot_of(key);
+    size_t target = capacity_;
+    for (size_t n = 0; n < capacity_; n++, idx = (idx + 1) & mask_) {
+        uint64_t slot_key = slots_[idx].key.load(std::memory_order_relaxed);
+        if (slot_key == key) {
+            begin_write();
+            slots_[idx].frame_id.store(frame_id, std::memory_order_relaxed);
+            end_write();
+            return;
+        }
+        if (slot_key == TOMBSTONE_KEY && target == capacity_) {
+            target = idx;
+        }
+        if (slot_key == EMPTY_KEY) {
+            if (target == capacity_) {
+                // 占用一个空槽，已删除的槽过多时先重新散列
+                if ((size_ + tombstones_ + 1) * 4 > capacity_ * 3) {
+                    rehash();
+                    insert(page_id, frame_id);
+                    return;
+                }
+                target = idx;
+            }
+            break;
+        }
+    }
+    assert(target != capacity_);
+    if (slots_[target].key.load(std::memory_order_relaxed) == TOMBSTONE_KEY) {
+        tombstones_--;
+    }
+    // 先写帧号再发布key，无锁查找看到key时一定能看到对应的帧号
+    slots_[target].frame_id.store(frame_id, std::memory_order_relaxed);
+    slots_[target].key.store(key, std::memory_order_release);
+    size_++;
+}
+
+bool PageTable::erase(const PageId &page_id) {
+    uint64_t key = pack(page_id);
+    size_t idx = slot_of(key);
+    for (size_t n = 0; n < capacity_; n++, idx = (idx + 1) & mask_) {
+        uint64_t slot_key = slots_[idx].key.load(std::memory_order_relaxed);
+        if (slot_key == key) {
+            // 删除之后槽位可能被其他页面复用，需要让正在读取该槽的无锁查找重试
+            begin_write();
+            // 后一个槽为空时没有探测序列经过这里，可以直接置为空槽
+            if (slots_[(idx + 1) & mask_].key.load(std::memory_order_relaxed) == EMPTY_KEY) {
+                slots_[idx].key.store(EMPTY_KEY, std::memory_order_relaxed);
+            } else {
+                slots_[idx].key.store(TOMBSTONE_KEY, std::memory_order_relaxed);
+                tombstones_++;
+            }
+            end_write();
+            size_--;
+            return true;
+        }
+        if (slot_key == EMPTY_KEY) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/**
+ * @description: 清除所有已删除槽并重新插入有效映射，调用者需持有分区的latch
+ */
+void PageTable::rehash() {
+    begin_write();
+    size_t count = 0;
+    for (size_t i = 0; i < capacity_; i++) {
+        uint64_t key = slots_[i].key.load(std::memory_order_relaxed);
+        if (key != EMPTY_KEY && key != TOMBSTONE_KEY) {
+            assert(count < num_frames_);
+            scratch_[count++] = {key, slots_[i].frame_id.load(std::memory_order_relaxed)};
+        }
+        slots_[i].key.store(EMPTY_KEY, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    tombstones_ = 0;
+    for (size_t i = 0; i < count; i++) {
+        insert(unpack(scratch_[i].first), scratch_[i].second);
+    }
+    end_write();
+}
@@ -0,0 +1,115 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "common/config.h"
+#include "page.h"
+
+/**
+ * @description: 缓冲池分区的页表，记录PageId到帧号的映射。
+ * 使用线性探测的开放寻址哈希表，槽位数为帧数的两倍以上，且在构造时一次分配，之后不再申请内存。
+ * 插入和删除由调用者在缓冲池分区的latch内串行执行；查找可以不加锁并发进行。
+ * 删除和重新散列会移动或复用槽位，修改前后各将版本号加一（seqlock），与之交错的无锁查找会重试。
+ * 查找返回之后映射仍可能被修改，调用者需要在pin住帧之后核对帧中的PageId
+ */
+class PageTable {
+   public:
+    /**
+     * @param {size_t} num_frames 缓冲池分区的帧数，即页表中最多同时存在的映射个数
+     */
+    explicit PageTable(size_t num_frames);
+
+    /**
+     * @description: 查找页面所在的帧，可以不加锁调用
+     * @return {bool} 是否找到
+     * @param {PageId} page_id 目标页面
+     * @param {frame_id_t*} frame_id 传出帧号
+     */
+    bool find(const PageId &page_id, frame_id_t *frame_id) const;
+
+    /**
+     * @description: 插入或更新页面的映射，调用者需持有分区的latch
+     */
+    void insert(const PageId &page_id, frame_id_t frame_id);
+
+    /**
+     * @description: 删除页面的映射，调用者需持有分区的latch
+     * @return {bool} 页面是否存在
+     */
+    bool erase(const PageId &page_id);
+
+    bool contains(const PageId &page_id) const {
+        frame_id_t frame_id;
+        return find(page_id, &frame_id);
+    }
+
+    /**
+     * @description: 遍历所有映射，调用者需持有分区的latch
+     */
+    template <typename Fn>
+    void for_each(Fn &&fn) const {
+        for (size_t i = 0; i < capacity_; i++) {
+            uint64_t key = slots_[i].key.load(std::memory_order_relaxed);
+            if (key != EMPTY_KEY && key != TOMBSTONE_KEY) {
+                fn(unpack(key), slots_[i].frame_id.load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    size_t size() const { return size_; }
+
+   private:
+    // fd为-1的PageId不会出现在页表中，用作空槽和已删除槽的标记
+    static constexpr uint64_t EMPTY_KEY = ~0ULL;
+    static constexpr uint64_t TOMBSTONE_KEY = ~0ULL - 1;
+
+    struct Slot {
+        std::atomic<uint64_t> key{EMPTY_KEY};
+        std::atomic<frame_id_t> frame_id{INVALID_FRAME_ID};
+    };
+
+    static uint64_t pack(const PageId &page_id) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(page_id.fd)) << 32) |
+               static_cast<uint32_t>(page_id.page_no);
+    }
+
+    static PageId unpack(uint64_t key) {
+        return PageId{static_cast<int>(key >> 32), static_cast<page_id_t>(static_cast<uint32_t>(key))};
+    }
+
+    size_t slot_of(uint64_t key) const;
+
+    bool probe(uint64_t key, frame_id_t *frame_id) const;
+
+    void rehash();
+
+    // seqlock的写端，调用者需持有分区的latch
+    void begin_write() {
+        version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void end_write() { version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    size_t num_frames_;
+    size_t capacity_;                   // 槽位数，为2的幂
+    size_t mask_;                       // capacity_ - 1
+    size_t size_ = 0;                   // 有效映射的个数
+    size_t tombstones_ = 0;             // 已删除槽的个数
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> version_{0};  // 为奇数时正在删除或重新散列
+    std::unique_ptr<std::pair<uint64_t, frame_id_t>[]> scratch_;  // 重新散列时暂存有效映射，容量与帧数相同
+};
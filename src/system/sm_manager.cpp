@@ -14,6 +14,7 @@ See the Mulan PSL v2 for more details. */
 #include <unistd.h>
 
 #include <fstream>
+#include <sstream>
 
 #include "index/ix.h"
 #include "record/rm.h"
@@ -91,6 +92,13 @@ void SmManager::open_db(const std::string& db_name) {
     for (auto &entry : db_.tabs_) {
         const std::string &tab_name = entry.first;
         fhs_.emplace(tab_name, rm_manager_->open_file(tab_name));
+        for (auto &index : entry.second.indexes) {
+            ihs_.emplace(ix_manager_->get_index_name(tab_name, index.cols), ix_manager_->open_index(tab_name, index.cols));
+        }
+    }
+
+    if (get_config("WARM_RESTART", "ON") == "ON") {
+        load_resident_pages();
     }
 }
 
@@ -108,9 +116,17 @@ void SmManager::flush_meta() {
 void SmManager::close_db() {
     flush_meta();
 
+    buffer_pool_manager_->stop_warm_up();
+    if (get_config("WARM_RESTART", "ON") == "ON") {
+        dump_resident_pages();
+    }
+
     for (auto itf = fhs_.begin(); itf != fhs_.end(); ++itf) {
         rm_manager_->close_file(itf->second.get());
     }
+    for (auto iti = ihs_.begin(); iti != ihs_.end(); ++iti) {
+        ix_manager_->close_index(iti->second.get());
+    }
 
     fhs_.clear();
     ihs_.clear();
@@ -120,6 +136,67 @@ void SmManager::close_db() {
     }
 }
 
+/**
+ * @description: 将缓冲池中属于当前数据库的页面按最近访问的先后写入BUFFER_POOL_DUMP_NAME，每行为文件名和页号。
+ * 下次打开数据库时据此预热缓冲池
+ */
+void SmManager::dump_resident_pages() {
+    std::unordered_map<int, std::string> fd2name;
+    for (auto& [name, fh] : fhs_) {
+        fd2name[fh->GetFd()] = name;
+    }
+    for (auto& [name, ih] : ihs_) {
+        fd2name[ih->get_fd()] = name;
+    }
+    // 先写入临时文件再改名，崩溃时不会留下写了一半的列表
+    std::string tmp_name = BUFFER_POOL_DUMP_NAME + ".tmp";
+    std::ofstream ofs(tmp_name);
+    for (auto& page_id : buffer_pool_manager_->get_resident_pages()) {
+        auto it = fd2name.find(page_id.fd);
+        if (it != fd2name.end()) {
+            ofs << it->second << ' ' << page_id.page_no << '\n';
+        }
+    }
+    ofs.close();
+    if (!ofs) {
+        unlink(tmp_name.c_str());
+        return;
+    }
+    if (rename(tmp_name.c_str(), BUFFER_POOL_DUMP_NAME.c_str()) < 0) {
+        throw UnixError();
+    }
+}
+
+/**
+ * @description: 读取上次关闭数据库时保存的页面列表，在后台将其中仍然存在的文件的页面读入缓冲池。
+ * 列表读出后即被删除，之后异常退出时下次启动不会按过期的列表预热（其中的页面可能已被释放或重用）
+ */
+void SmManager::load_resident_pages() {
+    std::ifstream ifs(BUFFER_POOL_DUMP_NAME);
+    if (!ifs.is_open()) {
+        return;
+    }
+    std::unordered_map<std::string, int> name2fd;
+    for (auto& [name, fh] : fhs_) {
+        name2fd[name] = fh->GetFd();
+    }
+    for (auto& [name, ih] : ihs_) {
+        name2fd[name] = ih->get_fd();
+    }
+    std::vector<PageId> pages;
+    std::string name;
+    page_id_t page_no;
+    while (ifs >> name >> page_no) {
+        auto it = name2fd.find(name);
+        if (it != name2fd.end()) {
+            pages.push_back({.fd = it->second, .page_no = page_no});
+        }
+    }
+    ifs.close();
+    unlink(BUFFER_POOL_DUMP_NAME.c_str());
+    buffer_pool_manager_->warm_up(std::move(pages));
+}
+
 /**
  * @description: 显示所有的表
  */
@@ -140,6 +217,42 @@ void SmManager::show_tables(Context* context) {
     outfile.close();
 }
 
+/**
+ * @description: 显示当前数据库中每张表、每个索引以及日志文件自打开以来的I/O统计，延迟的单位为微秒
+ */
+void SmManager::show_io_stats(Context* context) {
+    std::vector<std::string> captions = {"File",   "Type",     "Reads",       "Read KB",     "Read avg us",
+                                         "Read p99 us", "Writes", "Write KB", "Write avg us", "Write p99 us"};
+    RecordPrinter printer(captions.size());
+    printer.print_separator(context);
+    printer.print_record(captions, context);
+    printer.print_separator(context);
+    auto print_stats = [&](const std::string& name, const std::string& type, int fd) {
+        FileIOStats* stats = disk_manager_->get_io_stats(fd);
+        if (stats == nullptr) return;
+        FileIOStats::Snapshot snapshot = stats->snapshot();
+        std::vector<std::string> row = {name, type};
+        for (auto kind : {FileIOStats::READ, FileIOStats::WRITE}) {
+            uint64_t ops = snapshot.ops[kind];
+            row.push_back(std::to_string(ops));
+            row.push_back(std::to_string(snapshot.bytes[kind] / 1024));
+            row.push_back(std::to_string(ops == 0 ? 0 : snapshot.time_us[kind] / ops));
+            row.push_back(std::to_string(snapshot.percentile(kind, 0.99)));
+        }
+        printer.print_record(row, context);
+    };
+    for (auto& [name, fh] : fhs_) {
+        print_stats(name, "table", fh->GetFd());
+    }
+    for (auto& [name, ih] : ihs_) {
+        print_stats(name, "index", ih->get_fd());
+    }
+    if (disk_manager_->GetLogFd() != -1) {
+        print_stats(LOG_FILE_NAME, "log", disk_manager_->GetLogFd());
+    }
+    printer.print_separator(context);
+}
+
 /**
  * @description: 显示表的元数据
  */
@@ -158,6 +271,22 @@ void SmManager::desc_table(const std::string& tab_name, Context* context) {
     printer.print_separator(context);
 }
 
+/**
+ * @description: 新建的表是否压缩存储。环境变量RMDB_TABLE_COMPRESSION为ON时压缩所有新表，
+ * 也可以是以逗号分隔的表名列表，只压缩列出的表
+ * @param {string&} tab_name 表名
+ */
+static bool is_compressed_table(const std::string& tab_name) {
+    std::string tables = get_config("TABLE_COMPRESSION", "OFF");
+    if (tables == "ON") return true;
+    std::stringstream ss(tables);
+    std::string name;
+    while (std::getline(ss, name, ',')) {
+        if (name == tab_name) return true;
+    }
+    return false;
+}
+
 /**
  * @description: 创建表
  */
@@ -188,7 +317,7 @@ void SmManager::create_table(const std::string& tab_name,
 
     int record_size = curr_offset;
 
-    rm_manager_->create_file(tab_name, record_size);
+    rm_manager_->create_file(tab_name, record_size, is_compressed_table(tab_name));
     db_.tabs_[tab_name] = tab;
     fhs_.emplace(tab_name, rm_manager_->open_file(tab_name));
 
@@ -226,6 +355,8 @@ void SmManager::drop_table(const std::string& tab_name, Context* context) {
 
     auto itf = fhs_.find(tab_name);
     if (itf != fhs_.end()) {
+        // 预热线程可能仍在读这个文件，关闭后fd可能被其他文件重用
+        buffer_pool_manager_->stop_warm_up();
         rm_manager_->close_file(itf->second.get());
         fhs_.erase(itf);
     }
@@ -316,6 +447,7 @@ void SmManager::drop_index(const std::string& tab_name, const std::vector<std::s
 
     auto it = ihs_.find(index_name);
     if (it != ihs_.end()) {
+        buffer_pool_manager_->stop_warm_up();
         ix_manager_->close_index(it->second.get());
         ihs_.erase(it);
     }
@@ -492,4 +492,60 @@ TEST_F(BPlusTreeTests, LargeScaleTest) {
     }
     std::cout << "Insert keys count: " << add_cnt << '\n' << "Delete keys count: " << del_cnt << '\n';
     check_all(ih_.get(), mock);
-}
\ No newline at end of file
+}
+/**
+ * @brief 反复插入和删除同一批键值对，被合并释放的结点页面应当被复用，索引文件不会随轮数增长
+ */
+TEST_F(BPlusTreeTests, FreePageReuseTest) {
+    const int order = 8;
+    const int scale = 2000;
+    const int rounds = 5;
+
+    assert(order > 2 && order <= ih_->file_hdr_->btree_order_);
+    ih_->file_hdr_->btree_order_ = order;
+
+    std::vector<int> keys;
+    for (int key = 0; key < scale; key++) {
+        keys.push_back(key);
+    }
+    std::default_random_engine rng(2024);
+
+    std::multimap<int, Rid> mock;
+    int peak_pages = 0;
+    for (int round = 0; round < rounds; round++) {
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (int key : keys) {
+            if (mock.count(key)) continue;
+            Rid rid = {.page_no = round, .slot_no = key};
+            ASSERT_NE(ih_->insert_entry((const char *)&key, rid, txn_.get()), INVALID_PAGE_ID);
+            mock.insert(std::make_pair(key, rid));
+        }
+        if (round == 0) {
+            peak_pages = ih_->file_hdr_->num_pages_;
+        }
+        // 插入顺序不同会导致分裂位置略有差异，但不复用时文件会随轮数成倍增长
+        EXPECT_LE(ih_->file_hdr_->num_pages_, peak_pages * 11 / 10);
+
+        // 只保留一个键，避免变成空树
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (int i = 1; i < scale; i++) {
+            ASSERT_EQ(ih_->delete_entry((const char *)&keys[i], txn_.get()), true);
+            mock.erase(keys[i]);
+        }
+        EXPECT_NE(ih_->file_hdr_->first_free_page_no_, IX_NO_PAGE);
+        check_all(ih_.get(), mock);
+    }
+
+    // 空闲链表随文件头持久化，重新打开后继续复用
+    ix_manager_->close_index(ih_.get());
+    ih_ = ix_manager_->open_index(TEST_FILE_NAME, TEST_COL);
+    ih_->file_hdr_->btree_order_ = order;
+    for (int key : keys) {
+        if (mock.count(key)) continue;
+        Rid rid = {.page_no = rounds, .slot_no = key};
+        ASSERT_NE(ih_->insert_entry((const char *)&key, rid, txn_.get()), INVALID_PAGE_ID);
+        mock.insert(std::make_pair(key, rid));
+    }
+    EXPECT_LE(ih_->file_hdr_->num_pages_, peak_pages * 11 / 10);
+    check_all(ih_.get(), mock);
+}
@@ -0,0 +1,152 @@
+#include "storage/async_io.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "storage/disk_manager.h"
+
+const std::string TEST_FILE_NAME = "AsyncIOTest_file";
+
+class AsyncIOTest : public ::testing::TestWithParam<std::string> {
+   public:
+    int fd_ = -1;
+
+    void SetUp() override {
+        fd_ = open(TEST_FILE_NAME.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        ASSERT_GE(fd_, 0);
+    }
+
+    void TearDown() override {
+        close(fd_);
+        unlink(TEST_FILE_NAME.c_str());
+    }
+
+    /**
+     * @brief 创建指定类型的引擎，当前内核不支持io_uring时跳过
+     */
+    std::unique_ptr<AsyncIOEngine> create_engine(unsigned queue_depth) {
+        try {
+            return AsyncIOEngine::create(queue_depth, GetParam());
+        } catch (UnixError &e) {
+            return nullptr;
+        }
+    }
+};
+
+/**
+ * @brief 批量写入超过队列深度的页面后批量读回，检查内容和完成的请求
+ */
+TEST_P(AsyncIOTest, ReadWriteTest) {
+    const int num_pages = 256;
+    auto engine = create_engine(16);
+    if (engine == nullptr) GTEST_SKIP() << "io_uring is not available";
+    std::cout << "engine: " << engine->get_name() << std::endl;
+
+    std::vector<char> data(static_cast<size_t>(num_pages) * PAGE_SIZE);
+    std::vector<IORequest> writes(num_pages);
+    for (int i = 0; i < num_pages; i++) {
+        char *page = data.data() + static_cast<size_t>(i) * PAGE_SIZE;
+        memset(page, i & 0xff, PAGE_SIZE);
+        snprintf(page, PAGE_SIZE, "page %d", i);
+        writes[i].is_write = true;
+        writes[i].fd = fd_;
+        writes[i].page_no = i;
+        writes[i].buf = page;
+    }
+    EXPECT_EQ(0u, engine->execute(writes));
+
+    std::vector<char> read_back(data.size());
+    std::vector<IORequest> reads(num_pages);
+    // 逆序提交，完成顺序与提交顺序无关
+    for (int i = num_pages - 1; i >= 0; i--) {
+        reads[i].fd = fd_;
+        reads[i].page_no = i;
+        reads[i].buf = read_back.data() + static_cast<size_t>(i) * PAGE_SIZE;
+        reads[i].user_data = &reads[i];
+        engine->submit(&reads[i]);
+    }
+    std::vector<IORequest *> completed;
+    while (engine->get_inflight() > 0) {
+        engine->reap(&completed, 1);
+    }
+    ASSERT_EQ(static_cast<size_t>(num_pages), completed.size());
+    for (IORequest *request : completed) {
+        EXPECT_EQ(request, request->user_data);
+        EXPECT_TRUE(request->ok());
+    }
+    EXPECT_EQ(0, memcmp(data.data(), read_back.data(), data.size()));
+}
+
+/**
+ * @brief 出错的请求通过result返回错误，不影响同一批的其他请求
+ */
+TEST_P(AsyncIOTest, ErrorTest) {
+    auto engine = create_engine(4);
+    if (engine == nullptr) GTEST_SKIP() << "io_uring is not available";
+    char buf[PAGE_SIZE] = {0};
+    std::vector<IORequest> requests(3);
+    requests[0] = {.is_write = true, .fd = fd_, .page_no = 0, .buf = buf};
+    requests[1] = {.is_write = true, .fd = -1, .page_no = 0, .buf = buf};   // 无效的文件句柄
+    requests[2] = {.is_write = false, .fd = fd_, .page_no = 10, .buf = buf};  // 超出文件末尾
+    EXPECT_EQ(2u, engine->execute(requests));
+    EXPECT_TRUE(requests[0].ok());
+    EXPECT_EQ(-EBADF, requests[1].result);
+    EXPECT_EQ(0, requests[2].result);
+}
+
+/**
+ * @brief 比较同步pread与异步引擎的随机读吞吐量
+ */
+TEST_P(AsyncIOTest, RandomReadBenchmark) {
+    const int num_pages = 8192;
+    const int num_reads = 8192;
+    auto engine = create_engine(ASYNC_IO_QUEUE_DEPTH);
+    if (engine == nullptr) GTEST_SKIP() << "io_uring is not available";
+
+    std::vector<char> page(PAGE_SIZE, 'x');
+    for (int i = 0; i < num_pages; i++) {
+        ASSERT_EQ(PAGE_SIZE, pwrite(fd_, page.data(), PAGE_SIZE, static_cast<off_t>(i) * PAGE_SIZE));
+    }
+    fsync(fd_);
+    std::mt19937 rng(0);
+    std::vector<page_id_t> page_nos(num_reads);
+    for (auto &page_no : page_nos) page_no = rng() % num_pages;
+    std::unique_ptr<char, decltype(&free)> bufs(
+        static_cast<char *>(aligned_alloc(PAGE_SIZE, static_cast<size_t>(ASYNC_IO_QUEUE_DEPTH) * PAGE_SIZE)), &free);
+
+    posix_fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+    auto start = std::chrono::steady_clock::now();
+    for (page_id_t page_no : page_nos) {
+        ASSERT_EQ(PAGE_SIZE, pread(fd_, bufs.get(), PAGE_SIZE, static_cast<off_t>(page_no) * PAGE_SIZE));
+    }
+    double sync_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    posix_fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_reads; i += ASYNC_IO_QUEUE_DEPTH) {
+        std::vector<IORequest> requests;
+        for (int j = i; j < std::min(num_reads, i + static_cast<int>(ASYNC_IO_QUEUE_DEPTH)); j++) {
+            IORequest request;
+            request.fd = fd_;
+            request.page_no = page_nos[j];
+            request.buf = bufs.get() + static_cast<size_t>(j - i) * PAGE_SIZE;
+            requests.push_back(request);
+        }
+        ASSERT_EQ(0u, engine->execute(requests));
+    }
+    double async_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "engine: " << engine->get_name() << "\tsync reads/sec: " << static_cast<int>(num_reads / sync_secs)
+              << "\tasync reads/sec: " << static_cast<int>(num_reads / async_secs) << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Engines, AsyncIOTest, ::testing::Values("URING", "THREADS"));
@@ -1,14 +1,24 @@
 #include "storage/buffer_pool_manager.h"
 
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include <ctime>
+#include <iostream>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "record/rm.h"
+#include "system/sm_manager.h"
+#include "test_database.h"
 
 constexpr int MAX_FILES = 32;
 constexpr int MAX_PAGES = 128;
@@ -427,3 +437,753 @@ TEST_F(BufferPoolManagerTest, ConcurrencyTest) {
 
     disk_manager_->close_file(fd);
 }
+
+/**
+ * @brief 并发缺页测试：缓冲池远小于工作集，各线程修改各自的页面，检验latch之外的脏页写回与读入
+ * @note 生成测试文件concurrent_miss_test
+ */
+TEST_F(BufferPoolManagerTest, ConcurrentMissTest) {
+    const std::string filename = "concurrent_miss_test";
+    const int num_threads = 8;
+    const int num_pages = 256;
+    const int num_rounds = 2000;
+    const size_t buffer_pool_size = 16;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager);
+
+    PageId tmp_page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+    for (int i = 0; i < num_pages; i++) {
+        Page *page = bpm->new_page(&tmp_page_id);
+        ASSERT_NE(nullptr, page);
+        *reinterpret_cast<int *>(page->get_data()) = 0;
+        EXPECT_EQ(true, bpm->unpin_page(tmp_page_id, true));
+    }
+
+    // 第tid个线程负责page_no % num_threads == tid的页面，每次访问都检查并递增页面中的计数
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&bpm, tid, fd]() {
+            std::vector<int> counters(num_pages, 0);
+            std::mt19937 rng(tid);
+            for (int r = 0; r < num_rounds; r++) {
+                int page_no = (rng() % (num_pages / num_threads)) * num_threads + tid;
+                PageId page_id = {.fd = fd, .page_no = page_no};
+                Page *page = bpm->fetch_page(page_id);
+                while (page == nullptr) {
+                    page = bpm->fetch_page(page_id);
+                }
+                int *counter = reinterpret_cast<int *>(page->get_data());
+                EXPECT_EQ(counters[page_no], *counter);
+                counters[page_no] = ++(*counter);
+                EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // 所有修改都应能落盘
+    bpm->flush_all_pages(fd);
+    char buf[PAGE_SIZE];
+    int total = 0;
+    for (int i = 0; i < num_pages; i++) {
+        disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+        total += *reinterpret_cast<int *>(buf);
+    }
+    EXPECT_EQ(num_threads * num_rounds, total);
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 缓冲池分区的扩展性测试，比较单分区与多分区缓冲池在1~32个线程下fetch/unpin的吞吐量
+ * @note 生成测试文件scaling_benchmark。耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests；
+ * 多线程下的正确性由ConcurrencyTest和ConcurrentMissTest覆盖
+ */
+TEST_F(BufferPoolManagerTest, DISABLED_ScalingBenchmark) {
+    const std::string filename = "scaling_benchmark";
+    const size_t buffer_pool_size = 8192;
+    const int num_pages = 16384;  // 工作集为缓冲池的两倍，命中与缺页混合
+    const int total_ops = 100000;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    for (size_t num_instances : {static_cast<size_t>(1), static_cast<size_t>(BUFFER_POOL_INSTANCES)}) {
+        for (int num_threads = 1; num_threads <= 32; num_threads *= 2) {
+            auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, num_instances);
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> threads;
+            for (int tid = 0; tid < num_threads; tid++) {
+                threads.emplace_back([&bpm, tid, fd, num_threads, num_pages, total_ops]() {
+                    std::mt19937 rng(tid);
+                    for (int i = 0; i < total_ops / num_threads; i++) {
+                        PageId page_id = {.fd = fd, .page_no = static_cast<page_id_t>(rng() % num_pages)};
+                        Page *page = bpm->fetch_page(page_id);
+                        while (page == nullptr) {
+                            page = bpm->fetch_page(page_id);
+                        }
+                        EXPECT_EQ(page_id, page->get_page_id());
+                        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+                    }
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "instances: " << bpm->get_num_instances() << "\tthreads: " << num_threads
+                      << "\tops/sec: " << static_cast<int64_t>(total_ops / secs) << std::endl;
+        }
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 点查询与周期性全表扫描混合的负载下，比较LRU和LRU-K的缓冲池命中率
+ * @note 点查询反复访问一小部分热点页面（类似B+树内部结点），全表扫描依次访问远大于缓冲池的冷数据，
+ * 扫描时对每个页面连续访问两次（RmScan::next与get_record各fetch一次）
+ */
+TEST_F(BufferPoolManagerTest, ScanResistanceBenchmark) {
+    const std::string filename = "scan_resistance_benchmark";
+    const size_t buffer_pool_size = 1024;
+    const int num_hot_pages = 512;
+    const int num_scan_pages = 4096;
+    const int lookups_per_round = 2000;
+    const int num_rounds = 5;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_hot_pages + num_scan_pages; i++) {
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_hot_pages + num_scan_pages);
+
+    auto access = [fd](BufferPoolManager *bpm, int page_no) {
+        PageId page_id = {.fd = fd, .page_no = page_no};
+        Page *page = bpm->fetch_page(page_id);
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+    };
+
+    double lookup_hit_rate[2];
+    int idx = 0;
+    for (const std::string replacer_type : {"LRU", "LRUK"}) {
+        auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 1, replacer_type);
+        std::mt19937 rng(0);
+        uint64_t lookup_hits = 0;
+        uint64_t lookup_total = 0;
+        for (int round = 0; round < num_rounds; round++) {
+            uint64_t hits_before = bpm->get_hit_count();
+            uint64_t misses_before = bpm->get_miss_count();
+            for (int i = 0; i < lookups_per_round; i++) {
+                access(bpm.get(), rng() % num_hot_pages);
+            }
+            // 第一轮用于预热
+            if (round > 0) {
+                lookup_hits += bpm->get_hit_count() - hits_before;
+                lookup_total += bpm->get_hit_count() - hits_before + bpm->get_miss_count() - misses_before;
+            }
+            for (int page_no = num_hot_pages; page_no < num_hot_pages + num_scan_pages; page_no++) {
+                access(bpm.get(), page_no);
+                access(bpm.get(), page_no);
+            }
+        }
+        uint64_t hits = bpm->get_hit_count();
+        uint64_t total = hits + bpm->get_miss_count();
+        lookup_hit_rate[idx++] = static_cast<double>(lookup_hits) / lookup_total;
+        std::cout << "replacer: " << replacer_type << "\tlookup hit rate: " << static_cast<double>(lookup_hits) / lookup_total
+                  << "\toverall hit rate: " << static_cast<double>(hits) / total << std::endl;
+    }
+    // 扫描不应再冲掉热点页面
+    EXPECT_GT(lookup_hit_rate[1], lookup_hit_rate[0]);
+    EXPECT_GT(lookup_hit_rate[1], 0.95);
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 大表扫描使用BULK_READ策略时，并发的点查询命中率应保持不变
+ */
+TEST_F(BufferPoolManagerTest, BulkReadStrategyTest) {
+    const std::string filename = "bulk_read_strategy_test";
+    const size_t buffer_pool_size = 1024;
+    const int num_hot_pages = 512;
+    const int num_scan_pages = 4096;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_hot_pages + num_scan_pages; i++) {
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_hot_pages + num_scan_pages);
+
+    auto access = [fd](BufferPoolManager *bpm, int page_no, BufferAccessStrategy *strategy) {
+        PageId page_id = {.fd = fd, .page_no = page_no};
+        Page *page = bpm->fetch_page(page_id, strategy);
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(page_id, page->get_page_id());
+        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+    };
+
+    double lookup_hit_rate[2];
+    for (int use_strategy = 0; use_strategy < 2; use_strategy++) {
+        auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 4, "LRU");
+        for (int page_no = 0; page_no < num_hot_pages; page_no++) {
+            access(bpm.get(), page_no, nullptr);
+        }
+        // 扫描与点查询交替进行
+        BufferAccessStrategy strategy(BufferAccessType::BULK_READ);
+        std::mt19937 rng(0);
+        uint64_t misses_before = bpm->get_miss_count();
+        uint64_t lookup_hits = 0;
+        for (int page_no = num_hot_pages; page_no < num_hot_pages + num_scan_pages; page_no++) {
+            uint64_t hits = bpm->get_hit_count();
+            access(bpm.get(), rng() % num_hot_pages, nullptr);
+            lookup_hits += bpm->get_hit_count() - hits;
+            access(bpm.get(), page_no, use_strategy ? &strategy : nullptr);
+        }
+        lookup_hit_rate[use_strategy] = static_cast<double>(lookup_hits) / num_scan_pages;
+        std::cout << "strategy: " << (use_strategy ? "BULK_READ" : "none") << "\tlookup hit rate: "
+                  << lookup_hit_rate[use_strategy] << "\tscan misses: "
+                  << bpm->get_miss_count() - misses_before - (num_scan_pages - lookup_hits) << std::endl;
+    }
+    EXPECT_EQ(1.0, lookup_hit_rate[1]);
+    EXPECT_GT(lookup_hit_rate[1], lookup_hit_rate[0]);
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 使用BULK_WRITE策略批量创建页面，环中的脏页在复用前写回磁盘
+ */
+TEST_F(BufferPoolManagerTest, BulkWriteStrategyTest) {
+    const std::string filename = "bulk_write_strategy_test";
+    const size_t buffer_pool_size = 256;
+    const int num_pages = 2048;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 2);
+
+    // 其余的帧被占用，批量写只能在环内循环
+    std::vector<PageId> pinned;
+    for (size_t i = 0; i < buffer_pool_size - buffer_pool_size / 8; i++) {
+        PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+        ASSERT_NE(nullptr, bpm->new_page(&page_id));
+        pinned.push_back(page_id);
+    }
+    BufferAccessStrategy strategy(BufferAccessType::BULK_WRITE);
+    std::vector<PageId> written;
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id, &strategy);
+        ASSERT_NE(nullptr, page);
+        snprintf(page->get_data(), PAGE_SIZE, "%d", page_id.page_no);
+        EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+        written.push_back(page_id);
+    }
+    for (auto &page_id : pinned) {
+        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+    }
+    bpm->flush_all_pages(fd);
+    for (auto &page_id : written) {
+        char data[PAGE_SIZE];
+        disk_manager_->read_page(fd, page_id.page_no, data, PAGE_SIZE);
+        EXPECT_EQ(std::to_string(page_id.page_no), std::string(data));
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 后台写线程提前写回脏页，前台线程替换页面时需要自己写回的次数应显著减少，且数据不丢失
+ */
+TEST_F(BufferPoolManagerTest, PageCleanerTest) {
+    const std::string filename = "page_cleaner_test";
+    const size_t buffer_pool_size = 1024;
+    const int num_pages = 4096;
+    const int num_ops = 20000;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    uint64_t foreground_writes[2];
+    for (int use_cleaner = 0; use_cleaner < 2; use_cleaner++) {
+        auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager);
+        if (use_cleaner) {
+            bpm->start_page_cleaner(buffer_pool_size / 4, std::chrono::milliseconds(1));
+        }
+        std::vector<int> versions(num_pages, 0);
+        std::mt19937 rng(use_cleaner);
+        for (int i = 0; i < num_ops; i++) {
+            int page_no = rng() % num_pages;
+            PageId page_id = {.fd = fd, .page_no = page_no};
+            Page *page = bpm->fetch_page(page_id);
+            ASSERT_NE(nullptr, page);
+            EXPECT_EQ(versions[page_no], *reinterpret_cast<int *>(page->get_data()));
+            *reinterpret_cast<int *>(page->get_data()) = ++versions[page_no];
+            EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+            // 给后台写线程留出运行的机会
+            if (use_cleaner && i % 256 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        bpm->stop_page_cleaner();
+        bpm->flush_all_pages(fd);
+        for (int page_no = 0; page_no < num_pages; page_no++) {
+            disk_manager_->read_page(fd, page_no, buf, PAGE_SIZE);
+            EXPECT_EQ(versions[page_no], *reinterpret_cast<int *>(buf));
+            *reinterpret_cast<int *>(buf) = 0;
+            disk_manager_->write_page(fd, page_no, buf, PAGE_SIZE);
+        }
+        foreground_writes[use_cleaner] = bpm->get_foreground_write_count();
+        std::cout << "page cleaner: " << (use_cleaner ? "on" : "off")
+                  << "\tforeground writes: " << bpm->get_foreground_write_count()
+                  << "\tbackground writes: " << bpm->get_background_write_count() << std::endl;
+    }
+    EXPECT_LT(foreground_writes[1], foreground_writes[0] / 2);
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 预读的页面读入完成后访问应命中缓冲池，且内容与磁盘一致
+ */
+TEST_F(BufferPoolManagerTest, PrefetchTest) {
+    const std::string filename = "prefetch_test";
+    const int num_pages = 512;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        snprintf(buf, PAGE_SIZE, "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    auto bpm = std::make_unique<BufferPoolManager>(1024, disk_manager, 4);
+    // 第3页已在缓冲池中，预读时被跳过，整个范围被分成两段连续的读
+    PageId resident = {.fd = fd, .page_no = 3};
+    ASSERT_NE(nullptr, bpm->fetch_page(resident));
+    bpm->prefetch_pages({.fd = fd, .page_no = 0}, num_pages);
+    // 在页面读入过程中访问它们，需要等待预读完成
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id = {.fd = fd, .page_no = i};
+        Page *page = bpm->fetch_page(page_id);
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(std::to_string(i), std::string(page->get_data()));
+        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+    }
+    EXPECT_EQ(true, bpm->unpin_page(resident, false));
+    // 所有页面要么由预读读入，要么由fetch_page自己读入，不会读入两次
+    EXPECT_LE(bpm->get_miss_count(), static_cast<uint64_t>(num_pages));
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 测试热启动：get_resident_pages按最近访问的先后列出页面，warm_up将列出的页面读入新的缓冲池
+ */
+TEST_F(BufferPoolManagerTest, WarmRestartTest) {
+    const std::string filename = "warm_restart_test";
+    const int num_pages = 512;
+    const size_t pool_size = 128;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        snprintf(buf, PAGE_SIZE, "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    std::vector<PageId> resident;
+    {
+        auto bpm = std::make_unique<BufferPoolManager>(pool_size, disk_manager, 1);
+        for (int i = 0; i < num_pages; i++) {
+            PageId page_id = {.fd = fd, .page_no = i};
+            ASSERT_NE(nullptr, bpm->fetch_page(page_id));
+            bpm->unpin_page(page_id, false);
+        }
+        // 再次访问几个页面，它们应排在最前面；被pin住的页面排在所有未pin的页面之前
+        for (int page_no : {400, 450, 500}) {
+            PageId page_id = {.fd = fd, .page_no = page_no};
+            ASSERT_NE(nullptr, bpm->fetch_page(page_id));
+            bpm->unpin_page(page_id, false);
+        }
+        PageId pinned = {.fd = fd, .page_no = 420};
+        ASSERT_NE(nullptr, bpm->fetch_page(pinned));
+        resident = bpm->get_resident_pages();
+        ASSERT_EQ(pool_size, resident.size());
+        EXPECT_EQ(pinned, resident[0]);
+        EXPECT_EQ((PageId{.fd = fd, .page_no = 500}), resident[1]);
+        EXPECT_EQ((PageId{.fd = fd, .page_no = 450}), resident[2]);
+        EXPECT_EQ((PageId{.fd = fd, .page_no = 400}), resident[3]);
+        bpm->unpin_page(pinned, false);
+    }
+
+    // 只预热列表的前一半，这些页面之后的访问全部命中
+    const size_t num_warm = pool_size / 2;
+    auto bpm = std::make_unique<BufferPoolManager>(pool_size, disk_manager, 4);
+    auto start = std::chrono::steady_clock::now();
+    bpm->warm_up(std::vector<PageId>(resident.begin(), resident.begin() + num_warm));
+    bpm->stop_warm_up(false);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "warm up " << num_warm << " pages: " << ms << " ms" << std::endl;
+    EXPECT_EQ(0u, bpm->get_miss_count());
+    for (size_t i = 0; i < num_warm; i++) {
+        Page *page = bpm->fetch_page(resident[i]);
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(std::to_string(resident[i].page_no), std::string(page->get_data()));
+        bpm->unpin_page(resident[i], false);
+    }
+    EXPECT_EQ(0u, bpm->get_miss_count());
+    EXPECT_EQ(num_warm, bpm->get_hit_count());
+
+    // 预热可以在读入完成之前取消
+    bpm->warm_up(resident);
+    bpm->stop_warm_up();
+    bpm.reset();
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 测试数据库级别的热启动：close_db记录缓冲池中的表和索引页面，open_db打开表和索引后将它们预热回缓冲池
+ */
+TEST_F(BufferPoolManagerTest, WarmRestartIndexTest) {
+    const std::string db_name = "warm_restart_db";
+    const std::string tab_name = "t";
+    const int num_records = 2000;
+    const size_t pool_size = 256;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    std::string index_name;
+    {
+        TestDatabase db(disk_manager, pool_size);
+        SmManager &sm = db.sm;
+        sm.create_db(db_name);
+        sm.open_db(db_name);
+        sm.create_table(tab_name, {{"a", TYPE_INT, 4}}, nullptr);
+        sm.create_index(tab_name, {"a"}, nullptr);
+        index_name = db.ix_manager->get_index_name(tab_name, std::vector<std::string>{"a"});
+        auto fh = sm.fhs_.at(tab_name).get();
+        auto ih = sm.ihs_.at(index_name).get();
+        for (int i = 0; i < num_records; i++) {
+            Rid rid = fh->insert_record(reinterpret_cast<char *>(&i), nullptr);
+            ih->insert_entry(reinterpret_cast<const char *>(&i), rid, nullptr);
+        }
+        sm.close_db();
+    }
+
+    TestDatabase db(disk_manager, pool_size);
+    SmManager &sm = db.sm;
+    auto bpm = db.bpm.get();
+    sm.open_db(db_name);
+    bpm->stop_warm_up(false);
+    // 页面列表只使用一次，异常退出后不会再按它预热
+    EXPECT_FALSE(disk_manager->is_file(BUFFER_POOL_DUMP_NAME));
+    ASSERT_EQ(1u, sm.ihs_.count(index_name));
+    auto ih = sm.ihs_.at(index_name).get();
+    auto resident = bpm->get_resident_pages();
+    EXPECT_TRUE(std::any_of(resident.begin(), resident.end(),
+                            [&](const PageId &page_id) { return page_id.fd == ih->get_fd(); }));
+    // 重启前所有页面都在缓冲池中，预热之后在索引中查找不再缺页
+    uint64_t miss_count = bpm->get_miss_count();
+    for (int key : {0, num_records / 2, num_records - 1}) {
+        std::vector<Rid> result;
+        EXPECT_TRUE(ih->get_value(reinterpret_cast<const char *>(&key), &result, nullptr));
+        ASSERT_EQ(1u, result.size());
+        EXPECT_EQ(key, *reinterpret_cast<int *>(sm.fhs_.at(tab_name)->get_record(result[0], nullptr)->data));
+    }
+    EXPECT_EQ(miss_count, bpm->get_miss_count());
+    sm.close_db();
+    EXPECT_TRUE(disk_manager->is_file(db_name + "/" + BUFFER_POOL_DUMP_NAME));
+    EXPECT_FALSE(disk_manager->is_file(db_name + "/" + BUFFER_POOL_DUMP_NAME + ".tmp"));
+}
+
+/**
+ * @brief 测试页面句柄：析构时自动unpin、写句柄标记脏页、移动语义以及读写锁的互斥
+ */
+TEST_F(BufferPoolManagerTest, PageGuardTest) {
+    const std::string filename = "page_guard_test";
+    const int num_threads = 4;
+    const int num_iters = 2000;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    auto bpm = std::make_unique<BufferPoolManager>(16, disk_manager, 1);
+
+    PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+    {
+        WritePageGuard guard = bpm->new_page_write(&page_id);
+        ASSERT_TRUE(guard.is_valid());
+        memset(guard.get_data_mut(), 0, PAGE_SIZE);
+    }
+    // 句柄析构后页面已被unpin，并且被标记为脏页
+    EXPECT_EQ(false, bpm->unpin_page(page_id, false));
+    {
+        ReadPageGuard guard = bpm->fetch_page_read(page_id);
+        ASSERT_TRUE(guard.is_valid());
+        EXPECT_TRUE(guard.get_page()->is_dirty());
+        // 移动之后只有新句柄持有pin
+        ReadPageGuard moved = std::move(guard);
+        EXPECT_FALSE(guard.is_valid());
+        EXPECT_TRUE(moved.is_valid());
+        moved.release();
+        EXPECT_FALSE(moved.is_valid());
+        EXPECT_EQ(false, bpm->unpin_page(page_id, false));
+    }
+
+    // 写者同时修改页面中的两个计数器，读者在读锁内看到的两个计数器必须相等
+    std::vector<std::thread> threads;
+    std::atomic<bool> torn{false};
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num_iters; i++) {
+                if (t % 2 == 0) {
+                    WritePageGuard guard = bpm->fetch_page_write(page_id);
+                    int *counters = reinterpret_cast<int *>(guard.get_data_mut());
+                    counters[0]++;
+                    std::this_thread::yield();
+                    counters[1]++;
+                } else {
+                    ReadPageGuard guard = bpm->fetch_page_read(page_id);
+                    const int *counters = reinterpret_cast<const int *>(guard.get_data());
+                    if (counters[0] != counters[1]) torn = true;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(torn);
+    {
+        ReadPageGuard guard = bpm->fetch_page_read(page_id);
+        const int *counters = reinterpret_cast<const int *>(guard.get_data());
+        EXPECT_EQ(num_threads / 2 * num_iters, counters[0]);
+        EXPECT_EQ(num_threads / 2 * num_iters, counters[1]);
+    }
+    EXPECT_EQ(false, bpm->unpin_page(page_id, false));
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 测试flush_all_pages只写回指定文件的脏页，并且耗时只与脏页个数有关
+ */
+TEST_F(BufferPoolManagerTest, FlushAllPagesTest) {
+    const int num_pages = 8192;
+    const int num_dirty = 64;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file("flush_a");
+    disk_manager_->create_file("flush_b");
+    int fd_a = disk_manager_->open_file("flush_a");
+    int fd_b = disk_manager_->open_file("flush_b");
+    auto bpm = std::make_unique<BufferPoolManager>(num_pages * 2, disk_manager, 4);
+
+    // 两个文件各装满num_pages个页面，其中只有少量脏页
+    for (int fd : {fd_a, fd_b}) {
+        for (int i = 0; i < num_pages; i++) {
+            PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+            Page *page = bpm->new_page(&page_id);
+            ASSERT_NE(nullptr, page);
+            bpm->unpin_page(page_id, false);
+        }
+    }
+    // 一半脏页页号连续，另一半分散
+    std::vector<int> dirty_page_nos;
+    for (int i = 0; i < num_dirty / 2; i++) {
+        dirty_page_nos.push_back(100 + i);
+        dirty_page_nos.push_back(1000 + i * 97);
+    }
+    for (int fd : {fd_a, fd_b}) {
+        for (int page_no : dirty_page_nos) {
+            WritePageGuard guard = bpm->fetch_page_write({.fd = fd, .page_no = page_no});
+            snprintf(guard.get_data_mut(), PAGE_SIZE, "%d:%d", fd, page_no);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bpm->flush_all_pages(fd_a);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "flush_all_pages: pool " << num_pages * 2 << " frames, " << dirty_page_nos.size()
+              << " dirty pages, us: " << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()
+              << std::endl;
+
+    char buf[PAGE_SIZE];
+    for (int page_no : dirty_page_nos) {
+        disk_manager_->read_page(fd_a, page_no, buf, PAGE_SIZE);
+        EXPECT_EQ(std::to_string(fd_a) + ":" + std::to_string(page_no), std::string(buf));
+        ReadPageGuard guard_a = bpm->fetch_page_read({.fd = fd_a, .page_no = page_no});
+        EXPECT_FALSE(guard_a.get_page()->is_dirty());
+        // 另一个文件的脏页不受影响
+        ReadPageGuard guard_b = bpm->fetch_page_read({.fd = fd_b, .page_no = page_no});
+        EXPECT_TRUE(guard_b.get_page()->is_dirty());
+    }
+    // 再次刷盘时没有脏页需要写回
+    bpm->flush_all_pages(fd_a);
+    bpm->flush_all_pages(fd_b);
+    for (int page_no : dirty_page_nos) {
+        disk_manager_->read_page(fd_b, page_no, buf, PAGE_SIZE);
+        EXPECT_EQ(std::to_string(fd_b) + ":" + std::to_string(page_no), std::string(buf));
+    }
+    // 通过静态的mark_dirty标记的页面在unpin时加入脏页集合
+    PageId marked_id = {.fd = fd_a, .page_no = 7};
+    Page *marked = bpm->fetch_page(marked_id);
+    ASSERT_NE(nullptr, marked);
+    snprintf(marked->get_data(), PAGE_SIZE, "marked");
+    BufferPoolManager::mark_dirty(marked);
+    bpm->unpin_page(marked_id, false);
+    bpm->flush_all_pages(fd_a);
+    disk_manager_->read_page(fd_a, marked_id.page_no, buf, PAGE_SIZE);
+    EXPECT_EQ("marked", std::string(buf));
+
+    disk_manager_->close_file(fd_a);
+    disk_manager_->close_file(fd_b);
+}
+
+/**
+ * @brief 测试帧的数据区按页对齐且连续存放，与Page元数据分开
+ */
+TEST_F(BufferPoolManagerTest, FrameArenaTest) {
+    const size_t pool_size = 1000;
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file("arena_test");
+    int fd = disk_manager_->open_file("arena_test");
+    auto bpm = std::make_unique<BufferPoolManager>(pool_size, disk_manager, 4);
+
+    const FrameArena &arena = bpm->get_arena();
+    EXPECT_EQ(pool_size, arena.get_num_frames());
+    char *begin = arena.get_frame(0);
+    char *end = arena.get_frame(pool_size);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(begin) % PAGE_SIZE);
+    std::cout << "frame arena hugetlb: " << arena.is_hugetlb() << std::endl;
+
+    // 装满缓冲池，每个帧的数据都在数据区内且互不重叠
+    std::vector<char *> frames;
+    for (size_t i = 0; i < pool_size; i++) {
+        PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id);
+        ASSERT_NE(nullptr, page);
+        char *data = page->get_data();
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data) % PAGE_SIZE);
+        EXPECT_TRUE(data >= begin && data < end);
+        frames.push_back(data);
+        memset(data, static_cast<int>(i & 0xff), PAGE_SIZE);
+    }
+    std::sort(frames.begin(), frames.end());
+    EXPECT_EQ(frames.end(), std::unique(frames.begin(), frames.end()));
+    for (size_t i = 0; i < pool_size; i++) {
+        PageId page_id = {.fd = fd, .page_no = static_cast<page_id_t>(i)};
+        EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+    }
+    bpm->flush_all_pages(fd);
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 统计文件在内核页缓存中的页面个数
+ */
+static size_t page_cache_pages(int fd, size_t num_pages) {
+    size_t len = num_pages * PAGE_SIZE;
+    void *addr = mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) return 0;
+    size_t sys_page = sysconf(_SC_PAGESIZE);
+    std::vector<unsigned char> vec((len + sys_page - 1) / sys_page);
+    size_t resident = 0;
+    if (mincore(addr, len, vec.data()) == 0) {
+        for (unsigned char v : vec) resident += v & 1;
+    }
+    munmap(addr, len);
+    return resident * sys_page / PAGE_SIZE;
+}
+
+/**
+ * @brief 比较带缓存I/O与O_DIRECT在相同内存预算下的内存占用和吞吐量。
+ * 带缓存I/O时被访问过的页面在缓冲池和内核页缓存中各有一份；O_DIRECT的内存占用只有缓冲池，
+ * 因此把带缓存I/O的总占用全部交给缓冲池时命中率更高
+ * @note 耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests；O_DIRECT读写的正确性由DiskManagerTest.DirectIOTest覆盖
+ */
+TEST_F(BufferPoolManagerTest, DISABLED_DirectIOBenchmark) {
+    const int num_pages = 16384;
+    const size_t pool_size = 2048;
+    const int num_ops = 50000;
+
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file("direct_io_bench");
+    {
+        int fd = disk_manager_->open_file("direct_io_bench");
+        char buf[PAGE_SIZE] = {0};
+        for (int i = 0; i < num_pages; i++) {
+            snprintf(buf, PAGE_SIZE, "%d", i);
+            disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+        }
+        disk_manager_->close_file(fd);
+    }
+
+    // 80%的访问落在20%的页面上
+    auto run = [&](bool direct, size_t frames, size_t *footprint) {
+        disk_manager_->set_direct_io(direct);
+        int fd = disk_manager_->open_file("direct_io_bench");
+        fsync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        disk_manager_->set_fd2pageno(fd, num_pages);
+        auto bpm = std::make_unique<BufferPoolManager>(frames, disk_manager);
+        std::mt19937 rng(0);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_ops; i++) {
+            int page_no = rng() % 5 != 0 ? rng() % (num_pages / 5) : rng() % num_pages;
+            ReadPageGuard guard = bpm->fetch_page_read({.fd = fd, .page_no = page_no});
+            EXPECT_EQ(std::to_string(page_no), std::string(guard.get_data()));
+        }
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        size_t cached = page_cache_pages(fd, num_pages);
+        *footprint = frames + cached;
+        std::cout << "mode: " << (disk_manager_->is_direct(fd) ? "O_DIRECT" : "buffered") << "\tpool MB: "
+                  << frames * PAGE_SIZE / (1 << 20) << "\tpage cache MB: " << cached * PAGE_SIZE / (1 << 20)
+                  << "\thit rate: " << static_cast<double>(bpm->get_hit_count()) / num_ops
+                  << "\tops/sec: " << static_cast<int>(num_ops / secs) << std::endl;
+        bpm.reset();
+        disk_manager_->close_file(fd);
+    };
+    size_t buffered_footprint;
+    size_t direct_footprint;
+    run(false, pool_size, &buffered_footprint);
+    run(true, pool_size, &direct_footprint);
+    // 相同内存预算：带缓存I/O的缓冲池与页缓存的总占用全部交给O_DIRECT的缓冲池
+    run(true, buffered_footprint, &direct_footprint);
+    EXPECT_LE(direct_footprint, buffered_footprint);
+    disk_manager_->set_direct_io(false);
+}
@@ -0,0 +1,155 @@
+#include "replacer/clock_replacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "replacer/lru_replacer.h"
+
+/**
+ * @brief 简单测试ClockReplacer的基本功能
+ */
+TEST(ClockReplacerTest, SimpleTest) {
+    ClockReplacer clock_replacer(7);
+
+    // Scenario: unpin six elements, i.e. add them to the replacer.
+    clock_replacer.unpin(1);
+    clock_replacer.unpin(2);
+    clock_replacer.unpin(3);
+    clock_replacer.unpin(4);
+    clock_replacer.unpin(5);
+    clock_replacer.unpin(6);
+    clock_replacer.unpin(1);
+    EXPECT_EQ(6, clock_replacer.Size());
+
+    // Scenario: get three victims from the clock.
+    // All reference bits are set, so the first sweep clears them and victims come out in frame order.
+    int value;
+    clock_replacer.victim(&value);
+    EXPECT_EQ(1, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(2, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(3, value);
+
+    // Scenario: pin elements in the replacer.
+    // Note that 3 has already been victimized, so pinning 3 should have no effect.
+    clock_replacer.pin(3);
+    clock_replacer.pin(4);
+    EXPECT_EQ(2, clock_replacer.Size());
+
+    // Scenario: unpin 4. We expect that the reference bit of 4 will be set to 1.
+    clock_replacer.unpin(4);
+
+    // Scenario: continue looking for victims. 4 gets a second chance, so it is evicted last.
+    clock_replacer.victim(&value);
+    EXPECT_EQ(5, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(6, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(4, value);
+    EXPECT_EQ(0, clock_replacer.Size());
+    EXPECT_FALSE(clock_replacer.victim(&value));
+}
+
+/**
+ * @brief 多线程并发pin/unpin/victim，检查每个帧至多被淘汰一次且Size与实际状态一致
+ */
+TEST(ClockReplacerTest, ConcurrencyTest) {
+    const int num_threads = 8;
+    const int frames_per_thread = 1000;
+    const int num_frames = num_threads * frames_per_thread;
+    ClockReplacer clock_replacer(num_frames);
+
+    // 每个线程只操作属于自己的帧
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&clock_replacer, tid] {
+            std::mt19937 rng(tid);
+            for (int round = 0; round < 10; round++) {
+                for (int i = 0; i < frames_per_thread; i++) {
+                    frame_id_t fid = tid * frames_per_thread + i;
+                    clock_replacer.unpin(fid);
+                    if (rng() % 2) clock_replacer.pin(fid);
+                }
+            }
+            // 最后所有帧都处于可替换状态
+            for (int i = 0; i < frames_per_thread; i++) {
+                clock_replacer.unpin(tid * frames_per_thread + i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(num_frames, clock_replacer.Size());
+
+    // 并发淘汰，每个帧只能被一个线程取走
+    std::vector<std::vector<frame_id_t>> victims(num_threads);
+    threads.clear();
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&clock_replacer, &victims, tid] {
+            frame_id_t fid;
+            while (clock_replacer.victim(&fid)) {
+                victims[tid].push_back(fid);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::set<frame_id_t> all_victims;
+    for (auto &v : victims) {
+        for (frame_id_t fid : v) {
+            EXPECT_TRUE(all_victims.insert(fid).second);
+        }
+    }
+    EXPECT_EQ(num_frames, all_victims.size());
+    EXPECT_EQ(0, clock_replacer.Size());
+}
+
+/**
+ * @brief 比较ClockReplacer和LRUReplacer在缓冲池典型访问模式（pin/unpin为主，偶尔victim）下的单次操作耗时，
+ * 默认不运行，需要加--gtest_also_run_disabled_tests
+ */
+TEST(ClockReplacerTest, DISABLED_MicroBenchmark) {
+    const int num_frames = 4096;
+    const int num_ops = 1000000;
+
+    auto run = [&](Replacer *replacer) {
+        for (int i = 0; i < num_frames; i++) {
+            replacer->unpin(i);
+        }
+        std::mt19937 rng(0);
+        std::vector<frame_id_t> accesses(num_ops);
+        for (auto &fid : accesses) {
+            fid = rng() % num_frames;
+        }
+        auto start = std::chrono::steady_clock::now();
+        frame_id_t victim;
+        for (int i = 0; i < num_ops; i++) {
+            replacer->pin(accesses[i]);
+            replacer->unpin(accesses[i]);
+            if (i % 16 == 0 && replacer->victim(&victim)) {
+                replacer->unpin(victim);
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        return static_cast<double>(elapsed.count()) / num_ops;
+    };
+
+    LRUReplacer lru_replacer(num_frames);
+    ClockReplacer clock_replacer(num_frames);
+    double lru_ns = run(&lru_replacer);
+    double clock_ns = run(&clock_replacer);
+    printf("replacer: LRU ns/op: %.1f\n", lru_ns);
+    printf("replacer: CLOCK ns/op: %.1f\n", clock_ns);
+    EXPECT_EQ(num_frames, lru_replacer.Size());
+    EXPECT_EQ(num_frames, clock_replacer.Size());
+}
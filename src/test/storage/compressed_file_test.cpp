@@ -0,0 +1,266 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "execution/executor_seq_scan.h"
+#include "gtest/gtest.h"
+#include "lz4.h"
+#include "storage/buffer_pool_manager.h"
+#include "storage/disk_manager.h"
+#include "test_database.h"
+
+const std::string TEST_DB_NAME = "CompressedFileTest_db";
+const std::string TEST_FILE_NAME = "CompressedFileTest_file";
+
+class CompressedFileTest : public ::testing::Test {
+   public:
+    void SetUp() override {
+        DiskManager disk_manager;
+        if (disk_manager.is_dir(TEST_DB_NAME)) {
+            disk_manager.destroy_dir(TEST_DB_NAME);
+        }
+        if (disk_manager.is_file(TEST_FILE_NAME)) {
+            disk_manager.destroy_file(TEST_FILE_NAME);
+        }
+    }
+};
+
+/**
+ * @brief 压缩后能还原原始数据，不可压缩的数据不超过LZ4_compressBound
+ */
+TEST_F(CompressedFileTest, CodecRoundTrip) {
+    std::mt19937 rng(7);
+    char src[PAGE_SIZE];
+    char compressed[LZ4_COMPRESSBOUND(PAGE_SIZE)];
+    char out[PAGE_SIZE];
+    for (int fill : {0, 1, 2}) {
+        // 0: 全零页面 1: 短字符串加零填充 2: 随机数据
+        for (int i = 0; i < PAGE_SIZE; i++) {
+            src[i] = fill == 0 ? 0 : fill == 1 ? (i % 200 < 12 ? 'a' + i % 7 : 0) : static_cast<char>(rng());
+        }
+        int length = LZ4_compress_default(src, compressed, PAGE_SIZE, sizeof(compressed));
+        ASSERT_GT(length, 0);
+        if (fill != 2) {
+            EXPECT_LT(length, PAGE_SIZE / 4);
+        }
+        ASSERT_EQ(PAGE_SIZE, LZ4_decompress_safe(compressed, out, length, PAGE_SIZE));
+        EXPECT_EQ(0, memcmp(src, out, PAGE_SIZE));
+        // 输出空间不足时返回0，截断的输入不会越界
+        EXPECT_EQ(0, LZ4_compress_default(src, compressed, PAGE_SIZE, length - 1));
+        EXPECT_GT(0, LZ4_decompress_safe(compressed, out, length - 1, PAGE_SIZE - 1));
+    }
+}
+
+/**
+ * @brief 槽位中保存的是标准的LZ4块格式：由LZ4参考实现压缩的页面能够解压
+ */
+TEST_F(CompressedFileTest, DecodesReferenceBlock) {
+    // "RMDB page "重复到4096字节：10个字面量，offset为10、长度为4081的匹配，最后5个字面量
+    const unsigned char block[] = {0xaf, 0x52, 0x4d, 0x44, 0x42, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x0a,
+                                   0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                   0xff, 0xff, 0xff, 0xff, 0xed, 0x50, 0x4d, 0x44, 0x42, 0x20, 0x70};
+    char expected[PAGE_SIZE];
+    for (int i = 0; i < PAGE_SIZE; i++) {
+        expected[i] = "RMDB page "[i % 10];
+    }
+    char out[PAGE_SIZE];
+    ASSERT_EQ(PAGE_SIZE, LZ4_decompress_safe(reinterpret_cast<const char *>(block), out, sizeof(block), PAGE_SIZE));
+    EXPECT_EQ(0, memcmp(expected, out, PAGE_SIZE));
+}
+
+/**
+ * @brief 压缩文件的页面读写、重写时槽位的移动与重用，以及重新打开后从映射表恢复
+ */
+TEST_F(CompressedFileTest, ReadWriteAndReopen) {
+    const int num_pages = 64;
+    auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+    disk_manager->create_file(TEST_FILE_NAME, true);
+    int fd = disk_manager->open_file(TEST_FILE_NAME);
+    ASSERT_TRUE(disk_manager->is_compressed(fd));
+
+    std::mt19937 rng(11);
+    std::vector<std::vector<char>> pages(num_pages, std::vector<char>(PAGE_SIZE, 0));
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        // 偶数页面可压缩，奇数页面为随机数据
+        auto &page = pages[page_no];
+        for (int i = 0; i < PAGE_SIZE; i++) {
+            page[i] = page_no % 2 == 0 ? (i < 64 ? static_cast<char>(page_no) : 0) : static_cast<char>(rng());
+        }
+        disk_manager->write_page(fd, page_no, page.data(), PAGE_SIZE);
+    }
+    size_t stored = disk_manager->get_stored_bytes(fd);
+    EXPECT_LT(stored, static_cast<size_t>(num_pages) * PAGE_SIZE * 3 / 4);
+
+    // 重写的页面总是写入新的槽位，释放的原槽位被之后的页面重用
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        auto &page = pages[page_no];
+        for (int i = 0; i < PAGE_SIZE; i++) {
+            page[i] = page_no % 2 == 1 ? (i < 64 ? static_cast<char>(page_no) : 0) : static_cast<char>(rng());
+        }
+        disk_manager->write_page(fd, page_no, page.data(), PAGE_SIZE);
+    }
+    EXPECT_LE(disk_manager->get_stored_bytes(fd), stored + static_cast<size_t>(num_pages / 2) * PAGE_SIZE);
+
+    // 只写页面开头的一部分时保留其余部分
+    char header[16];
+    memset(header, 0x5a, sizeof(header));
+    disk_manager->write_page(fd, 1, header, sizeof(header));
+    memcpy(pages[1].data(), header, sizeof(header));
+
+    disk_manager->close_file(fd);
+    fd = disk_manager->open_file(TEST_FILE_NAME);
+    ASSERT_TRUE(disk_manager->is_compressed(fd));
+    char buf[PAGE_SIZE];
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager->read_page(fd, page_no, buf, PAGE_SIZE);
+        ASSERT_EQ(0, memcmp(pages[page_no].data(), buf, PAGE_SIZE)) << "page " << page_no;
+    }
+    char part[100];
+    disk_manager->read_page(fd, 2, part, sizeof(part));
+    EXPECT_EQ(0, memcmp(pages[2].data(), part, sizeof(part)));
+    EXPECT_THROW(disk_manager->read_page(fd, num_pages, buf, PAGE_SIZE), InternalError);
+
+    // 重新打开后槽位之间的空隙仍然可以重用
+    size_t before = disk_manager->get_stored_bytes(fd);
+    memset(buf, 0, PAGE_SIZE);
+    disk_manager->write_page(fd, num_pages, buf, PAGE_SIZE);
+    EXPECT_EQ(before, disk_manager->get_stored_bytes(fd));
+
+    disk_manager->close_file(fd);
+    disk_manager->destroy_file(TEST_FILE_NAME);
+    EXPECT_FALSE(disk_manager->is_file(TEST_FILE_NAME + PAGE_MAP_SUFFIX));
+}
+
+/**
+ * @brief 其他线程读写压缩文件时，反复打开和关闭另一个压缩文件
+ */
+TEST_F(CompressedFileTest, OpenCloseWhileReading) {
+    const int num_pages = 16;
+    const int num_threads = 4;
+    const std::string other = TEST_FILE_NAME + "_other";
+    auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+    disk_manager->create_file(TEST_FILE_NAME, true);
+    disk_manager->create_file(other, true);
+    int fd = disk_manager->open_file(TEST_FILE_NAME);
+    char page[PAGE_SIZE];
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        memset(page, page_no, PAGE_SIZE);
+        disk_manager->write_page(fd, page_no, page, PAGE_SIZE);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            char buf[PAGE_SIZE];
+            for (int i = t; !stop; i++) {
+                int page_no = i % num_pages;
+                if (t == 0) {
+                    memset(buf, page_no, PAGE_SIZE);
+                    disk_manager->write_page(fd, page_no, buf, PAGE_SIZE);
+                } else {
+                    disk_manager->read_page(fd, page_no, buf, PAGE_SIZE);
+                    if (buf[0] != static_cast<char>(page_no) || buf[PAGE_SIZE - 1] != static_cast<char>(page_no)) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; i++) {
+        int other_fd = disk_manager->open_file(other);
+        EXPECT_TRUE(disk_manager->is_compressed(other_fd));
+        disk_manager->write_page(other_fd, 0, page, PAGE_SIZE);
+        disk_manager->close_file(other_fd);
+    }
+    stop = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, mismatches.load());
+
+    disk_manager->close_file(fd);
+    disk_manager->destroy_file(TEST_FILE_NAME);
+    disk_manager->destroy_file(other);
+}
+
+/**
+ * @brief 宽CHAR列的表压缩后磁盘占用不到一半，扫描结果不变；并比较压缩与不压缩时的冷扫描时间
+ * @note 扫描前通过posix_fadvise丢弃表文件在操作系统页缓存中的页面
+ */
+static void run_wide_char_table(int num_pages, size_t buffer_pool_size) {
+    const std::string plain = "plain";
+    const std::string packed = "packed";
+    setenv("RMDB_TABLE_COMPRESSION", packed.c_str(), 1);
+    size_t num_records = 0;
+    {
+        auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+        TestDatabase db(disk_manager.get());
+        SmManager &sm = db.sm;
+        sm.create_db(TEST_DB_NAME);
+        sm.open_db(TEST_DB_NAME);
+        for (auto &tab_name : {plain, packed}) {
+            sm.create_table(tab_name,
+                            {{"id", TYPE_INT, 4}, {"name", TYPE_STRING, 120}, {"addr", TYPE_STRING, 200}}, nullptr);
+            RmFileHandle *fh = sm.fhs_.at(tab_name).get();
+            EXPECT_EQ(tab_name == packed, disk_manager->is_compressed(fh->GetFd()));
+            char record[324];
+            num_records = 0;
+            while (fh->get_file_hdr().num_pages < num_pages) {
+                memset(record, 0, sizeof(record));
+                *reinterpret_cast<int *>(record) = static_cast<int>(num_records);
+                snprintf(record + 4, 120, "name_%zu", num_records);
+                snprintf(record + 124, 200, "street %zu", num_records % 997);
+                fh->insert_record(record, nullptr);
+                num_records++;
+            }
+        }
+        sm.close_db();
+    }
+    unsetenv("RMDB_TABLE_COMPRESSION");
+
+    for (auto &tab_name : {plain, packed}) {
+        std::string path = TEST_DB_NAME + "/" + tab_name;
+        int fd = open(path.c_str(), O_RDONLY);
+        ASSERT_GE(fd, 0);
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+
+        auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+        TestDatabase db(disk_manager.get(), buffer_pool_size);
+        SmManager &sm = db.sm;
+        sm.open_db(TEST_DB_NAME);
+        size_t stored = disk_manager->get_stored_bytes(sm.fhs_.at(tab_name)->GetFd());
+
+        SeqScanExecutor scan(&sm, tab_name, {}, nullptr);
+        auto start = std::chrono::steady_clock::now();
+        size_t scanned = 0;
+        for (scan.beginTuple(); !scan.is_end(); scan.nextTuple()) {
+            scanned++;
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(num_records, scanned);
+        if (tab_name == packed) {
+            EXPECT_LT(stored, static_cast<size_t>(num_pages) * PAGE_SIZE / 2);
+        }
+        std::cout << tab_name << ": " << stored / 1024 << " KB on disk, cold scan " << ms << " ms" << std::endl;
+        sm.close_db();
+    }
+}
+
+TEST_F(CompressedFileTest, WideCharTableTest) { run_wide_char_table(64, 16); }
+
+// 冷扫描时间对比使用8MB的表，耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests
+TEST_F(CompressedFileTest, DISABLED_WideCharTableBenchmark) { run_wide_char_table(2048, 256); }
@@ -0,0 +1,204 @@
+#include "storage/disk_backend.h"
+
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "storage/buffer_pool_manager.h"
+#include "storage/disk_manager.h"
+
+const std::string TEST_FILE_NAME = "DiskBackendTest_file";
+
+class DiskBackendTest : public ::testing::Test {
+   public:
+    void TearDown() override { unlink(TEST_FILE_NAME.c_str()); }
+
+    /**
+     * @brief 创建测试文件并打开
+     */
+    int create_and_open(DiskManager *disk_manager) {
+        if (disk_manager->is_file(TEST_FILE_NAME)) {
+            disk_manager->destroy_file(TEST_FILE_NAME);
+        }
+        disk_manager->create_file(TEST_FILE_NAME);
+        return disk_manager->open_file(TEST_FILE_NAME);
+    }
+
+    static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+/**
+ * @brief 内存后端的页面读写、部分页面读写、关闭后重新打开以及删除文件
+ */
+TEST_F(DiskBackendTest, MemoryBackendTest) {
+    DiskManager disk_manager(std::make_unique<MemoryDiskBackend>());
+    EXPECT_FALSE(disk_manager.is_native());
+    int fd = create_and_open(&disk_manager);
+
+    const int num_pages = 32;
+    std::vector<std::vector<char>> pages(num_pages, std::vector<char>(PAGE_SIZE));
+    std::mt19937 rng(0);
+    for (int i = 0; i < num_pages; i++) {
+        for (auto &c : pages[i]) c = static_cast<char>(rng());
+    }
+    std::vector<const char *> bufs;
+    for (auto &page : pages) bufs.push_back(page.data());
+    disk_manager.write_pages(fd, 1, bufs.data(), num_pages - 1);
+    disk_manager.write_page(fd, 0, pages[0].data(), 100);  // 文件头只写页面的一部分
+
+    char buf[PAGE_SIZE];
+    disk_manager.read_page(fd, 0, buf, 100);
+    EXPECT_EQ(0, memcmp(buf, pages[0].data(), 100));
+    for (int i = 1; i < num_pages; i++) {
+        disk_manager.read_page(fd, i, buf, PAGE_SIZE);
+        EXPECT_EQ(0, memcmp(buf, pages[i - 1].data(), PAGE_SIZE));
+    }
+    EXPECT_THROW(disk_manager.read_page(fd, num_pages, buf, PAGE_SIZE), InternalError);
+    // 数据不写入磁盘文件
+    EXPECT_EQ(0, disk_manager.get_file_size(TEST_FILE_NAME));
+    disk_manager.close_file(fd);
+
+    // 重新打开后数据仍在
+    fd = disk_manager.open_file(TEST_FILE_NAME);
+    disk_manager.read_page(fd, num_pages - 1, buf, PAGE_SIZE);
+    EXPECT_EQ(0, memcmp(buf, pages[num_pages - 2].data(), PAGE_SIZE));
+    disk_manager.close_file(fd);
+
+    // 删除文件后数据被释放
+    disk_manager.destroy_file(TEST_FILE_NAME);
+    fd = create_and_open(&disk_manager);
+    EXPECT_THROW(disk_manager.read_page(fd, 0, buf, PAGE_SIZE), InternalError);
+    disk_manager.close_file(fd);
+}
+
+/**
+ * @brief 内存后端在第一次访问时读入磁盘文件原有的内容
+ */
+TEST_F(DiskBackendTest, MemoryBackendLoadsExistingFile) {
+    char data[PAGE_SIZE * 2];
+    for (size_t i = 0; i < sizeof(data); i++) data[i] = static_cast<char>(i * 7);
+    {
+        DiskManager disk_manager(std::make_unique<PosixDiskBackend>());
+        int fd = create_and_open(&disk_manager);
+        disk_manager.write_page(fd, 0, data, PAGE_SIZE);
+        disk_manager.write_page(fd, 1, data + PAGE_SIZE, PAGE_SIZE / 2);
+        disk_manager.close_file(fd);
+    }
+    DiskManager disk_manager(std::make_unique<MemoryDiskBackend>());
+    int fd = disk_manager.open_file(TEST_FILE_NAME);
+    char buf[PAGE_SIZE];
+    disk_manager.read_page(fd, 1, buf, PAGE_SIZE);
+    EXPECT_EQ(0, memcmp(buf, data + PAGE_SIZE, PAGE_SIZE / 2));
+    char zeros[PAGE_SIZE / 2] = {0};
+    EXPECT_EQ(0, memcmp(buf + PAGE_SIZE / 2, zeros, PAGE_SIZE / 2));
+    disk_manager.read_page(fd, 0, buf, PAGE_SIZE);
+    EXPECT_EQ(0, memcmp(buf, data, PAGE_SIZE));
+    disk_manager.close_file(fd);
+}
+
+/**
+ * @brief 注入的延迟对每个请求生效，并发请求的延迟相互重叠；带宽限制按传输字节数排队
+ */
+TEST_F(DiskBackendTest, LatencyBackendTest) {
+    const auto latency = std::chrono::microseconds(2000);
+    DiskManager disk_manager(
+        std::make_unique<LatencyDiskBackend>(std::make_unique<MemoryDiskBackend>(), latency, latency, 0));
+    int fd = create_and_open(&disk_manager);
+    char buf[PAGE_SIZE] = {0};
+
+    const int num_writes = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_writes; i++) {
+        disk_manager.write_page(fd, i, buf, PAGE_SIZE);
+    }
+    EXPECT_GE(elapsed_ms(start), num_writes * 2.0);
+
+    // 4个线程同时读，总耗时接近单个线程而不是4倍
+    const int num_threads = 4;
+    start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&] {
+            char local[PAGE_SIZE];
+            for (int i = 0; i < num_writes; i++) {
+                disk_manager.read_page(fd, i, local, PAGE_SIZE);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    double concurrent_ms = elapsed_ms(start);
+    EXPECT_GE(concurrent_ms, num_writes * 2.0);
+    EXPECT_LT(concurrent_ms, num_threads * num_writes * 2.0);
+    disk_manager.close_file(fd);
+
+    // 带宽为4MB/s时，写入256KB至少需要62.5ms，合并为一次请求只付一次延迟
+    DiskManager slow_disk(std::make_unique<LatencyDiskBackend>(std::make_unique<MemoryDiskBackend>(),
+                                                               std::chrono::microseconds(0), latency, 4 << 20));
+    fd = slow_disk.open_file(TEST_FILE_NAME);
+    const int num_pages = 64;
+    std::vector<const char *> bufs(num_pages, buf);
+    start = std::chrono::steady_clock::now();
+    slow_disk.write_pages(fd, 0, bufs.data(), num_pages);
+    EXPECT_GE(elapsed_ms(start), 62.5);
+    slow_disk.close_file(fd);
+}
+
+/**
+ * @brief 在慢磁盘上运行缓冲池：后台写线程通过DiskManager写回，不绕过注入的延迟，前台线程替换页面时需要同步写回的次数减少
+ */
+TEST_F(DiskBackendTest, BufferPoolOnLatencyBackend) {
+    const int num_pages = 256;
+    const size_t buffer_pool_size = 64;
+    const int num_ops = 2000;
+    DiskManager disk_manager(std::make_unique<LatencyDiskBackend>(
+        std::make_unique<MemoryDiskBackend>(), std::chrono::microseconds(100), std::chrono::microseconds(100), 0));
+    int fd = create_and_open(&disk_manager);
+    char buf[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager.write_page(fd, page_no, buf, PAGE_SIZE);
+    }
+
+    size_t foreground_writes[2];
+    for (int use_cleaner = 0; use_cleaner < 2; use_cleaner++) {
+        BufferPoolManager bpm(buffer_pool_size, &disk_manager);
+        if (use_cleaner) {
+            bpm.start_page_cleaner(buffer_pool_size / 2, std::chrono::milliseconds(1));
+        }
+        std::vector<int> versions(num_pages, 0);
+        std::mt19937 rng(use_cleaner);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_ops; i++) {
+            int page_no = rng() % num_pages;
+            PageId page_id = {.fd = fd, .page_no = page_no};
+            Page *page = bpm.fetch_page(page_id);
+            ASSERT_NE(nullptr, page);
+            EXPECT_EQ(versions[page_no], *reinterpret_cast<int *>(page->get_data()));
+            *reinterpret_cast<int *>(page->get_data()) = ++versions[page_no];
+            EXPECT_EQ(true, bpm.unpin_page(page_id, true));
+        }
+        double ms = elapsed_ms(start);
+        bpm.stop_page_cleaner();
+        bpm.flush_all_pages(fd);
+        for (int page_no = 0; page_no < num_pages; page_no++) {
+            disk_manager.read_page(fd, page_no, buf, PAGE_SIZE);
+            EXPECT_EQ(versions[page_no], *reinterpret_cast<int *>(buf));
+            *reinterpret_cast<int *>(buf) = 0;
+            disk_manager.write_page(fd, page_no, buf, PAGE_SIZE);
+        }
+        foreground_writes[use_cleaner] = bpm.get_foreground_write_count();
+        std::cout << (use_cleaner ? "with" : "without") << " page cleaner: " << ms << " ms, "
+                  << foreground_writes[use_cleaner] << " foreground writes" << std::endl;
+    }
+    EXPECT_LT(foreground_writes[1], foreground_writes[0]);
+    disk_manager.close_file(fd);
+}
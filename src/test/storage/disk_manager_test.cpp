@@ -1,7 +1,10 @@
 #include "storage/disk_manager.h"
 
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -147,3 +150,170 @@ TEST_F(DiskManagerTest, PageOperation) {
     disk_manager_->destroy_file(filename);
     EXPECT_EQ(disk_manager_->is_file(filename), false);
 }
+
+/**
+ * @brief 测试分配页面时按extent预留磁盘空间，文件的逻辑大小仍由写入决定
+ */
+TEST_F(DiskManagerTest, ExtentPreallocationTest) {
+    const std::string filename = "ExtentTestFile";
+    const int extent_pages = 16;
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    disk_manager_->set_extent_pages(extent_pages);
+    int fd = disk_manager_->open_file(filename);
+    disk_manager_->set_fd2pageno(fd, 0);
+    EXPECT_EQ(disk_manager_->get_extent_end(fd), 0);
+
+    char data[PAGE_SIZE];
+    for (int page_no = 0; page_no < extent_pages + 1; page_no++) {
+        EXPECT_EQ(disk_manager_->allocate_page(fd), page_no);
+        EXPECT_EQ(disk_manager_->get_extent_end(fd), (page_no / extent_pages + 1) * extent_pages);
+        rand_buf(data, PAGE_SIZE);
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+        EXPECT_EQ(disk_manager_->get_file_size(filename), (page_no + 1) * PAGE_SIZE);
+    }
+    struct stat st;
+    ASSERT_EQ(fstat(fd, &st), 0);
+    if (st.st_blocks * 512 < 2 * extent_pages * PAGE_SIZE) {
+        std::cout << "fallocate is not supported by the file system, nothing is reserved" << std::endl;
+    }
+    disk_manager_->close_file(fd);
+
+    // 重新打开时从文件末尾开始预留
+    fd = disk_manager_->open_file(filename);
+    EXPECT_EQ(disk_manager_->get_extent_end(fd), extent_pages + 1);
+    disk_manager_->set_fd2pageno(fd, extent_pages + 1);
+    EXPECT_EQ(disk_manager_->allocate_page(fd), extent_pages + 1);
+    EXPECT_EQ(disk_manager_->get_extent_end(fd), 2 * extent_pages);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+
+    // 不合法的RMDB_FILE_EXTENT_PAGES回退到默认值，而不是让构造函数抛出异常
+    for (const char *value : {"abc", "16pages", "-1", "99999999999999999999"}) {
+        setenv("RMDB_FILE_EXTENT_PAGES", value, 1);
+        EXPECT_NO_THROW(DiskManager());
+    }
+    unsetenv("RMDB_FILE_EXTENT_PAGES");
+}
+
+/**
+ * @brief 测试O_DIRECT模式下对齐与不对齐缓冲区的页面读写，以及日志文件不使用O_DIRECT
+ */
+TEST_F(DiskManagerTest, DirectIOTest) {
+    const std::string filename = "DirectIOTestFile";
+    const int num_pages = 16;
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    disk_manager_->set_direct_io(true);
+    int fd = disk_manager_->open_file(filename);
+    if (!disk_manager_->is_direct(fd)) {
+        std::cout << "O_DIRECT is not supported by the file system, testing the fallback" << std::endl;
+    }
+
+    // 按页对齐的缓冲区直接读写，使用向量读写
+    std::unique_ptr<char, decltype(&free)> aligned(
+        static_cast<char *>(aligned_alloc(PAGE_SIZE, PAGE_SIZE * num_pages)), &free);
+    std::vector<char *> bufs;
+    for (int i = 0; i < num_pages; i++) {
+        rand_buf(aligned.get() + i * PAGE_SIZE, PAGE_SIZE);
+        bufs.push_back(aligned.get() + i * PAGE_SIZE);
+    }
+    disk_manager_->write_pages(fd, 1, bufs.data(), num_pages);
+    std::vector<char> expected(aligned.get(), aligned.get() + PAGE_SIZE * num_pages);
+    memset(aligned.get(), 0, PAGE_SIZE * num_pages);
+    disk_manager_->read_pages(fd, 1, bufs.data(), num_pages);
+    EXPECT_EQ(0, memcmp(expected.data(), aligned.get(), PAGE_SIZE * num_pages));
+
+    // 文件头等不对齐的小块数据经由中转缓冲区读写，不影响页面的其余部分
+    char hdr[100];
+    rand_buf(hdr, sizeof(hdr));
+    disk_manager_->write_page(fd, 0, hdr, sizeof(hdr));
+    disk_manager_->write_page(fd, 2, hdr, sizeof(hdr));
+    char read_hdr[100] = {0};
+    disk_manager_->read_page(fd, 0, read_hdr, sizeof(read_hdr));
+    EXPECT_EQ(0, memcmp(hdr, read_hdr, sizeof(hdr)));
+    char page[PAGE_SIZE + 1];
+    disk_manager_->read_page(fd, 2, page + 1, PAGE_SIZE);
+    EXPECT_EQ(0, memcmp(hdr, page + 1, sizeof(hdr)));
+    EXPECT_EQ(0, memcmp(expected.data() + PAGE_SIZE + sizeof(hdr), page + 1 + sizeof(hdr), PAGE_SIZE - sizeof(hdr)));
+    disk_manager_->close_file(fd);
+
+    // 日志文件保持带缓存的I/O
+    if (!disk_manager_->is_file(LOG_FILE_NAME)) {
+        disk_manager_->create_file(LOG_FILE_NAME);
+    }
+    int log_fd = disk_manager_->open_file(LOG_FILE_NAME);
+    EXPECT_FALSE(disk_manager_->is_direct(log_fd));
+    disk_manager_->close_file(log_fd);
+    disk_manager_->destroy_file(LOG_FILE_NAME);
+
+    disk_manager_->set_direct_io(false);
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 测试每个文件的I/O统计：次数、字节数和延迟直方图，多线程记录时各条带相加后不丢失，重新打开时清零
+ */
+TEST_F(DiskManagerTest, IOStatsTest) {
+    const std::string filename = "IOStatsTestFile";
+    const int num_pages = 8;
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    FileIOStats *stats = disk_manager_->get_io_stats(fd);
+    ASSERT_NE(stats, nullptr);
+
+    char data[PAGE_SIZE];
+    rand_buf(data, PAGE_SIZE);
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    char *bufs[num_pages];
+    std::vector<char> pages(PAGE_SIZE * num_pages);
+    for (int i = 0; i < num_pages; i++) bufs[i] = pages.data() + i * PAGE_SIZE;
+    disk_manager_->read_pages(fd, 0, bufs, num_pages);
+    disk_manager_->read_page(fd, 1, data, 100);
+
+    FileIOStats::Snapshot snapshot = stats->snapshot();
+    EXPECT_EQ(snapshot.ops[FileIOStats::WRITE], num_pages);
+    EXPECT_EQ(snapshot.bytes[FileIOStats::WRITE], num_pages * PAGE_SIZE);
+    EXPECT_EQ(snapshot.ops[FileIOStats::READ], 2);
+    EXPECT_EQ(snapshot.bytes[FileIOStats::READ], num_pages * PAGE_SIZE + 100);
+    uint64_t in_buckets = 0;
+    for (uint64_t count : snapshot.latency[FileIOStats::WRITE]) in_buckets += count;
+    EXPECT_EQ(in_buckets, num_pages);
+    EXPECT_GE(snapshot.percentile(FileIOStats::WRITE, 0.99), snapshot.percentile(FileIOStats::WRITE, 0.5));
+
+    EXPECT_EQ(FileIOStats::get_bucket(0), 0);
+    EXPECT_EQ(FileIOStats::get_bucket(1), 1);
+    EXPECT_EQ(FileIOStats::get_bucket(3), 2);
+    EXPECT_EQ(FileIOStats::get_bucket(1ULL << 40), FileIOStats::NUM_BUCKETS - 1);
+
+    // 绕过DiskManager的读写由调用者计入统计
+    const int num_threads = 4;
+    const int ops_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < ops_per_thread; i++) disk_manager_->record_io(fd, FileIOStats::READ, 1, 3);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    snapshot = stats->snapshot();
+    EXPECT_EQ(snapshot.ops[FileIOStats::READ], 2 + num_threads * ops_per_thread);
+    EXPECT_EQ(snapshot.latency[FileIOStats::READ][2] >= num_threads * ops_per_thread, true);
+    EXPECT_EQ(snapshot.percentile(FileIOStats::READ, 0.99), 4);
+
+    disk_manager_->close_file(fd);
+    fd = disk_manager_->open_file(filename);
+    snapshot = disk_manager_->get_io_stats(fd)->snapshot();
+    EXPECT_EQ(snapshot.ops[FileIOStats::READ] + snapshot.ops[FileIOStats::WRITE], 0);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
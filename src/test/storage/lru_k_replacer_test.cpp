@@ -0,0 +1,144 @@
+#include "replacer/lru_k_replacer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief 简单测试LRUKReplacer的基本功能
+ */
+TEST(LRUKReplacerTest, SimpleTest) {
+    LRUKReplacer lru_k_replacer(7, 2, 0);
+
+    // Scenario: access frames 1-6, frame 1 twice so that it has a finite k-distance.
+    for (int i = 1; i <= 6; i++) {
+        lru_k_replacer.record_access(i, true);
+    }
+    lru_k_replacer.record_access(1);
+    for (int i = 1; i <= 6; i++) {
+        lru_k_replacer.unpin(i);
+    }
+    lru_k_replacer.unpin(1);
+    EXPECT_EQ(6, lru_k_replacer.Size());
+
+    // Scenario: frames with less than K accesses are evicted first, in LRU order.
+    int value;
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(2, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(3, value);
+
+    // Scenario: pin and access frame 4 again, now it has two accesses.
+    lru_k_replacer.pin(4);
+    lru_k_replacer.record_access(4);
+    EXPECT_EQ(3, lru_k_replacer.Size());
+    lru_k_replacer.unpin(4);
+
+    // Scenario: 5 and 6 have infinite k-distance; then 1 whose 2nd most recent access is older than 4's.
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(5, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(6, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(1, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(4, value);
+    EXPECT_EQ(0, lru_k_replacer.Size());
+    EXPECT_FALSE(lru_k_replacer.victim(&value));
+
+    // Scenario: loading a new page into a frame discards its history.
+    lru_k_replacer.record_access(4, true);
+    lru_k_replacer.record_access(5, true);
+    lru_k_replacer.record_access(5);
+    lru_k_replacer.record_access(4, true);
+    lru_k_replacer.unpin(4);
+    lru_k_replacer.unpin(5);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(4, value);
+}
+
+/**
+ * @brief 相关访问（时间间隔不超过correlated_period）只算作一次访问
+ */
+TEST(LRUKReplacerTest, CorrelatedAccessTest) {
+    LRUKReplacer lru_k_replacer(4, 2, 1);
+
+    // frame 0 is a hot page accessed twice with other accesses in between
+    lru_k_replacer.record_access(0, true);
+    lru_k_replacer.record_access(1, true);
+    lru_k_replacer.record_access(0);
+    // frame 2 is scanned: two back-to-back accesses
+    lru_k_replacer.record_access(2, true);
+    lru_k_replacer.record_access(2);
+    lru_k_replacer.unpin(0);
+    lru_k_replacer.unpin(1);
+    lru_k_replacer.unpin(2);
+
+    int value;
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(1, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(2, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(0, value);
+}
+
+/**
+ * @brief 多线程并发访问，检查每个帧至多被淘汰一次
+ */
+TEST(LRUKReplacerTest, ConcurrencyTest) {
+    const int num_threads = 8;
+    const int frames_per_thread = 1000;
+    const int num_frames = num_threads * frames_per_thread;
+    LRUKReplacer lru_k_replacer(num_frames);
+
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&lru_k_replacer, tid] {
+            std::mt19937 rng(tid);
+            for (int round = 0; round < 5; round++) {
+                for (int i = 0; i < frames_per_thread; i++) {
+                    frame_id_t fid = tid * frames_per_thread + i;
+                    lru_k_replacer.pin(fid);
+                    lru_k_replacer.record_access(fid, round == 0);
+                    if (rng() % 2) lru_k_replacer.unpin(fid);
+                }
+            }
+            for (int i = 0; i < frames_per_thread; i++) {
+                lru_k_replacer.unpin(tid * frames_per_thread + i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(num_frames, lru_k_replacer.Size());
+
+    std::vector<std::vector<frame_id_t>> victims(num_threads);
+    threads.clear();
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&lru_k_replacer, &victims, tid] {
+            frame_id_t fid;
+            while (lru_k_replacer.victim(&fid)) {
+                victims[tid].push_back(fid);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::set<frame_id_t> all_victims;
+    for (auto &v : victims) {
+        for (frame_id_t fid : v) {
+            EXPECT_TRUE(all_victims.insert(fid).second);
+        }
+    }
+    EXPECT_EQ(num_frames, all_victims.size());
+    EXPECT_EQ(0, lru_k_replacer.Size());
+}
@@ -0,0 +1,227 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "execution/executor_seq_scan.h"
+#include "gtest/gtest.h"
+#include "storage/async_io.h"
+#include "storage/buffer_pool_manager.h"
+#include "storage/disk_manager.h"
+#include "test_database.h"
+
+const std::string TEST_DB_NAME = "MmapReadTest_db";
+const std::string TEST_FILE_NAME = "MmapReadTest_file";
+
+class MmapReadTest : public ::testing::Test {
+   public:
+    void SetUp() override {
+        DiskManager disk_manager;
+        if (disk_manager.is_dir(TEST_DB_NAME)) {
+            disk_manager.destroy_dir(TEST_DB_NAME);
+        }
+    }
+};
+
+/**
+ * @brief 只读访问的页面直接指向文件映射；写访问前复制回帧中，文件被写过之后回到普通读路径
+ */
+TEST_F(MmapReadTest, ZeroCopyAndFallback) {
+    const int num_pages = 8;
+    auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+    disk_manager->set_mmap_read(true);
+    if (disk_manager->is_file(TEST_FILE_NAME)) {
+        disk_manager->destroy_file(TEST_FILE_NAME);
+    }
+    disk_manager->create_file(TEST_FILE_NAME);
+    int fd = disk_manager->open_file(TEST_FILE_NAME);
+    char buf[PAGE_SIZE];
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        memset(buf, page_no, PAGE_SIZE);
+        disk_manager->write_page(fd, page_no, buf, PAGE_SIZE);
+    }
+    // 写过的文件不提供映射，重新打开之后才会映射
+    EXPECT_EQ(nullptr, disk_manager->map_page(fd, 0));
+    disk_manager->close_file(fd);
+    fd = disk_manager->open_file(TEST_FILE_NAME);
+    const char *mapped = disk_manager->map_page(fd, 3);
+    ASSERT_NE(nullptr, mapped);
+    EXPECT_EQ(nullptr, disk_manager->map_page(fd, num_pages));
+
+    auto bpm = std::make_unique<BufferPoolManager>(16, disk_manager.get());
+    PageId page_id = {.fd = fd, .page_no = 3};
+    {
+        ReadPageGuard guard = bpm->fetch_page_read(page_id);
+        EXPECT_EQ(mapped, guard.get_data());
+        EXPECT_EQ(3, guard.get_data()[PAGE_SIZE - 1]);
+    }
+    {
+        // 写访问得到帧自己的副本，内容相同
+        WritePageGuard guard = bpm->fetch_page_write(page_id);
+        EXPECT_NE(mapped, guard.get_data());
+        EXPECT_EQ(3, guard.get_data()[PAGE_SIZE - 1]);
+        guard.get_data_mut()[0] = 42;
+    }
+    {
+        ReadPageGuard guard = bpm->fetch_page_read(page_id);
+        EXPECT_NE(mapped, guard.get_data());
+        EXPECT_EQ(42, guard.get_data()[0]);
+    }
+    bpm->flush_all_pages(fd);
+    // MAP_SHARED的映射能看到写回的内容；文件被写过之后不再提供映射
+    EXPECT_EQ(42, mapped[0]);
+    EXPECT_EQ(nullptr, disk_manager->map_page(fd, 5));
+    {
+        ReadPageGuard guard = bpm->fetch_page_read({.fd = fd, .page_no = 5});
+        EXPECT_EQ(5, guard.get_data()[0]);
+    }
+    bpm.reset();
+    disk_manager->close_file(fd);
+    disk_manager->destroy_file(TEST_FILE_NAME);
+}
+
+/**
+ * @brief 后台写回使用的I/O引擎绕过DiskManager直接写fd，写过之后同样不再提供映射
+ */
+TEST_F(MmapReadTest, AsyncWriteDisablesMapping) {
+    auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+    disk_manager->set_mmap_read(true);
+    if (disk_manager->is_file(TEST_FILE_NAME)) {
+        disk_manager->destroy_file(TEST_FILE_NAME);
+    }
+    disk_manager->create_file(TEST_FILE_NAME);
+    int fd = disk_manager->open_file(TEST_FILE_NAME);
+    alignas(PAGE_SIZE) static char buf[PAGE_SIZE];
+    memset(buf, 1, PAGE_SIZE);
+    disk_manager->write_page(fd, 0, buf, PAGE_SIZE);
+    disk_manager->close_file(fd);
+    fd = disk_manager->open_file(TEST_FILE_NAME);
+    ASSERT_NE(nullptr, disk_manager->map_page(fd, 0));
+
+    auto engine = AsyncIOEngine::create(ASYNC_IO_QUEUE_DEPTH, "", disk_manager.get());
+    std::vector<IORequest> requests(1);
+    requests[0].is_write = true;
+    requests[0].fd = fd;
+    requests[0].page_no = 0;
+    requests[0].buf = buf;
+    ASSERT_EQ(0u, engine->execute(requests));
+    EXPECT_EQ(nullptr, disk_manager->map_page(fd, 0));
+    disk_manager->close_file(fd);
+    disk_manager->destroy_file(TEST_FILE_NAME);
+}
+
+/**
+ * @brief 只读映射页面所在的帧被淘汰后复用于new_page时，必须回到帧自身的缓冲区，不能清零只读的映射
+ */
+TEST_F(MmapReadTest, ReuseMappedFrameForNewPage) {
+    const std::string other_file_name = TEST_FILE_NAME + "_other";
+    auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+    disk_manager->set_mmap_read(true);
+    for (auto &name : {TEST_FILE_NAME, other_file_name}) {
+        if (disk_manager->is_file(name)) {
+            disk_manager->destroy_file(name);
+        }
+        disk_manager->create_file(name);
+    }
+    int fd = disk_manager->open_file(TEST_FILE_NAME);
+    char buf[PAGE_SIZE];
+    memset(buf, 7, PAGE_SIZE);
+    disk_manager->write_page(fd, 0, buf, PAGE_SIZE);
+    disk_manager->close_file(fd);
+    fd = disk_manager->open_file(TEST_FILE_NAME);
+    int other_fd = disk_manager->open_file(other_file_name);
+
+    auto bpm = std::make_unique<BufferPoolManager>(1, disk_manager.get(), 1);
+    const char *mapped = disk_manager->map_page(fd, 0);
+    ASSERT_NE(nullptr, mapped);
+    {
+        ReadPageGuard guard = bpm->fetch_page_read({.fd = fd, .page_no = 0});
+        EXPECT_EQ(mapped, guard.get_data());
+    }
+    PageId new_page_id = {.fd = other_fd, .page_no = INVALID_PAGE_ID};
+    Page *page = bpm->new_page(&new_page_id);
+    ASSERT_NE(nullptr, page);
+    EXPECT_NE(mapped, page->get_data());
+    EXPECT_EQ(0, page->get_data()[0]);
+    EXPECT_EQ(7, mapped[0]);
+    bpm->unpin_page(new_page_id, false);
+    {
+        // 被替换出去的映射页面可以再次读入
+        ReadPageGuard guard = bpm->fetch_page_read({.fd = fd, .page_no = 0});
+        EXPECT_EQ(7, guard.get_data()[PAGE_SIZE - 1]);
+    }
+    bpm.reset();
+    disk_manager->close_file(fd);
+    disk_manager->close_file(other_fd);
+    disk_manager->destroy_file(TEST_FILE_NAME);
+    disk_manager->destroy_file(other_file_name);
+}
+
+/**
+ * @brief 分别用普通读路径与mmap读路径执行SeqScanExecutor，检查结果并比较两者的吞吐量
+ * @note 表大于缓冲池但在操作系统页缓存中，扫描的开销主要是把页面复制到缓冲池的帧中
+ */
+static void run_seq_scan(int num_pages, size_t buffer_pool_size) {
+    const std::string tab_name = "t";
+    size_t num_records = 0;
+    {
+        auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+        TestDatabase db(disk_manager.get());
+        SmManager &sm = db.sm;
+        sm.create_db(TEST_DB_NAME);
+        sm.open_db(TEST_DB_NAME);
+        sm.create_table(tab_name, {{"id", TYPE_INT, 4}, {"val", TYPE_INT, 4}, {"pad", TYPE_STRING, 120}}, nullptr);
+        RmFileHandle *fh = sm.fhs_.at(tab_name).get();
+        char record[128] = {0};
+        while (fh->get_file_hdr().num_pages < num_pages) {
+            *reinterpret_cast<int *>(record) = static_cast<int>(num_records);
+            *reinterpret_cast<int *>(record + 4) = static_cast<int>(num_records % 100);
+            fh->insert_record(record, nullptr);
+            num_records++;
+        }
+        sm.close_db();
+    }
+
+    // val < 10
+    Condition cond;
+    cond.lhs_col = {tab_name, "val"};
+    cond.op = OP_LT;
+    cond.is_rhs_val = true;
+    cond.rhs_val.set_int(10);
+    cond.rhs_val.init_raw(sizeof(int));
+
+    for (bool mmap_read : {false, true}) {
+        auto disk_manager = std::make_unique<DiskManager>(std::make_unique<PosixDiskBackend>());
+        disk_manager->set_mmap_read(mmap_read);
+        TestDatabase db(disk_manager.get(), buffer_pool_size);
+        SmManager &sm = db.sm;
+        sm.open_db(TEST_DB_NAME);
+
+        const int rounds = 3;
+        double best_ms = 0;
+        size_t matched = 0;
+        for (int round = 0; round < rounds; round++) {
+            SeqScanExecutor scan(&sm, tab_name, {cond}, nullptr);
+            auto start = std::chrono::steady_clock::now();
+            matched = 0;
+            for (scan.beginTuple(); !scan.is_end(); scan.nextTuple()) {
+                matched++;
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            // 第一轮用于预热操作系统页缓存
+            if (round > 0 && (best_ms == 0 || ms < best_ms)) best_ms = ms;
+        }
+        EXPECT_EQ(num_records / 100 * 10 + std::min<size_t>(num_records % 100, 10), matched);
+        std::cout << (mmap_read ? "mmap" : "read") << " path: " << num_records / best_ms / 1000
+                  << " M records/s (" << best_ms << " ms), buffer pool misses: " << db.bpm->get_miss_count()
+                  << std::endl;
+        sm.close_db();
+    }
+}
+
+TEST_F(MmapReadTest, SeqScanTest) { run_seq_scan(64, 16); }
+
+// 吞吐量对比使用16MB的表，耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests
+TEST_F(MmapReadTest, DISABLED_SeqScanBenchmark) { run_seq_scan(4096, 512); }
@@ -0,0 +1,130 @@
+#include "storage/page_table.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief 简单测试PageTable的插入、查找和删除，包括旧哈希函数下会冲突的PageId
+ */
+TEST(PageTableTest, SimpleTest) {
+    PageTable page_table(8);
+    frame_id_t frame_id;
+
+    // (fd << 16) | page_no 下这两个页面的哈希值相同
+    PageId a = {.fd = 0, .page_no = 65536};
+    PageId b = {.fd = 1, .page_no = 0};
+    page_table.insert(a, 1);
+    page_table.insert(b, 2);
+    EXPECT_EQ(2, page_table.size());
+    ASSERT_TRUE(page_table.find(a, &frame_id));
+    EXPECT_EQ(1, frame_id);
+    ASSERT_TRUE(page_table.find(b, &frame_id));
+    EXPECT_EQ(2, frame_id);
+    EXPECT_FALSE(page_table.contains({.fd = 1, .page_no = 65536}));
+
+    // 更新已有映射
+    page_table.insert(a, 3);
+    EXPECT_EQ(2, page_table.size());
+    ASSERT_TRUE(page_table.find(a, &frame_id));
+    EXPECT_EQ(3, frame_id);
+
+    EXPECT_TRUE(page_table.erase(a));
+    EXPECT_FALSE(page_table.erase(a));
+    EXPECT_FALSE(page_table.contains(a));
+    EXPECT_TRUE(page_table.contains(b));
+    EXPECT_EQ(1, page_table.size());
+
+    int count = 0;
+    page_table.for_each([&](const PageId &page_id, frame_id_t fid) {
+        EXPECT_EQ(b, page_id);
+        EXPECT_EQ(2, fid);
+        count++;
+    });
+    EXPECT_EQ(1, count);
+}
+
+/**
+ * @brief 反复插入删除，与std::unordered_map对比，覆盖已删除槽的复用和重新散列
+ */
+TEST(PageTableTest, ChurnTest) {
+    const int num_frames = 256;
+    PageTable page_table(num_frames);
+    std::unordered_map<PageId, frame_id_t> mock;
+    std::mt19937 rng(0);
+
+    for (int i = 0; i < 200000; i++) {
+        PageId page_id = {.fd = static_cast<int>(rng() % 4), .page_no = static_cast<page_id_t>(rng() % 100000)};
+        if (mock.size() < num_frames && rng() % 2 == 0) {
+            frame_id_t fid = static_cast<frame_id_t>(rng() % num_frames);
+            page_table.insert(page_id, fid);
+            mock[page_id] = fid;
+        } else if (!mock.empty()) {
+            PageId victim = mock.begin()->first;
+            EXPECT_TRUE(page_table.erase(victim));
+            mock.erase(victim);
+        }
+        ASSERT_EQ(mock.size(), page_table.size());
+    }
+    for (auto &[page_id, fid] : mock) {
+        frame_id_t frame_id;
+        ASSERT_TRUE(page_table.find(page_id, &frame_id));
+        EXPECT_EQ(fid, frame_id);
+    }
+}
+
+/**
+ * @brief 一个线程修改页表的同时，其他线程不加锁查找。
+ * 一直存在的页面总能被找到，返回的帧号只能是该页面曾经映射过的帧号
+ */
+TEST(PageTableTest, ConcurrentLookupTest) {
+    const int num_frames = 128;
+    const int num_readers = 3;
+    PageTable page_table(num_frames);
+    // 常驻页面的帧号为其页号，不会被删除
+    for (int i = 0; i < num_frames / 2; i++) {
+        page_table.insert({.fd = 0, .page_no = i}, i);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> errors{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < num_readers; t++) {
+        readers.emplace_back([&]() {
+            while (!stop) {
+                for (int i = 0; i < num_frames / 2; i++) {
+                    frame_id_t frame_id;
+                    if (!page_table.find({.fd = 0, .page_no = i}, &frame_id) || frame_id != i) {
+                        errors++;
+                    }
+                }
+            }
+        });
+    }
+    // 写者在另一个文件上反复插入删除，触发已删除槽的复用
+    std::mt19937 rng(0);
+    std::vector<PageId> resident;
+    for (int i = 0; i < 200000; i++) {
+        if (resident.size() < num_frames / 2) {
+            PageId page_id = {.fd = 1, .page_no = static_cast<page_id_t>(rng() % 1000000)};
+            if (!page_table.contains(page_id)) {
+                page_table.insert(page_id, num_frames / 2 + static_cast<frame_id_t>(resident.size()));
+                resident.push_back(page_id);
+            }
+        } else {
+            size_t idx = rng() % resident.size();
+            page_table.erase(resident[idx]);
+            resident[idx] = resident.back();
+            resident.pop_back();
+        }
+    }
+    stop = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0, errors);
+}
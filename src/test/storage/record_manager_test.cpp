@@ -4,11 +4,16 @@
 #include "record/rm.h"
 #undef private  // for use private variables in "rm.h"
 
+#include <fcntl.h>
+
 #include <cassert>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "gtest/gtest.h"
 #define BUFFER_LENGTH 8192
@@ -38,6 +43,9 @@ void check_equal(const RmFileHandle *file_handle,
         auto mock_buf = (char *)entry.second.c_str();
         auto rec = file_handle->get_record(rid, context);
         assert(memcmp(mock_buf, rec->data, file_handle->file_hdr_.record_size) == 0);
+        RecordView view = file_handle->get_record_view(rid, context);
+        assert(view.size() == file_handle->file_hdr_.record_size);
+        assert(memcmp(mock_buf, view.data(), file_handle->file_hdr_.record_size) == 0);
     }
     // Randomly get record
     for (int i = 0; i < 10; i++) {
@@ -56,6 +64,24 @@ void check_equal(const RmFileHandle *file_handle,
         num_records++;
     }
     assert(num_records == mock.size());
+    // Test RM batch scan
+    num_records = 0;
+    RmBatchScan batch_scan(file_handle);
+    RmPageBatch batch;
+    std::vector<std::pair<Rid, RecordView>> views;  // 每个页面的第一条记录，视图在批次释放后仍然有效
+    while (batch_scan.next_batch(&batch)) {
+        views.emplace_back(batch.rid(0), batch.view(0));
+        for (size_t i = 0; i < batch.size(); i++) {
+            assert(mock.count(batch.rid(i)) > 0);
+            assert(memcmp(batch.record(i), mock.at(batch.rid(i)).c_str(), file_handle->file_hdr_.record_size) == 0);
+            num_records++;
+        }
+    }
+    assert(batch.empty());
+    assert(num_records == mock.size());
+    for (auto &[rid, view] : views) {
+        assert(memcmp(view.data(), mock.at(rid).c_str(), file_handle->file_hdr_.record_size) == 0);
+    }
 }
 
 // std::cout can call this, for example: std::cout << rid
@@ -223,4 +249,383 @@ TEST(RecordManagerTest, MultipleFilesTest) {
         std::string filename = filenames[i];
         rm_manager->destroy_file(filename);
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief 冷缓存下分别关闭与开启预读顺序扫描整张表，检查扫描到的记录数并比较两者的吞吐量
+ * @note 每次扫描前用posix_fadvise丢弃操作系统页缓存中该文件的页面，并使用新的缓冲池
+ */
+static void run_cold_scan(const std::string &filename, int num_pages) {
+    const int record_size = 256;
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    size_t num_records = 0;
+    {
+        auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+        auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+        rm_manager->create_file(filename, record_size);
+        auto file_handle = rm_manager->open_file(filename);
+        char buf[record_size];
+        while (file_handle->file_hdr_.num_pages < num_pages) {
+            rand_buf(record_size, buf);
+            file_handle->insert_record(buf, nullptr);
+            num_records++;
+        }
+        rm_manager->close_file(file_handle.get());
+    }
+
+    for (int window : {0, SCAN_READAHEAD_PAGES}) {
+        auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+        buffer_pool_manager->set_scan_readahead(window);
+        auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+        auto file_handle = rm_manager->open_file(filename);
+        fdatasync(file_handle->fd_);
+        posix_fadvise(file_handle->fd_, 0, 0, POSIX_FADV_DONTNEED);
+
+        auto start = std::chrono::steady_clock::now();
+        size_t cnt = 0;
+        for (RmScan scan(file_handle.get()); !scan.is_end(); scan.next()) {
+            cnt++;
+        }
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(num_records, cnt);
+        std::cout << "readahead: " << window << "\tscan MB/s: " << num_pages * (PAGE_SIZE / 1024.0 / 1024.0) / secs
+                  << std::endl;
+        rm_manager->close_file(file_handle.get());
+    }
+    disk_manager->destroy_file(filename);
+}
+
+TEST(RecordManagerTest, ColdScanTest) { run_cold_scan("cold_scan_test.txt", 256); }
+
+/**
+ * @brief 预读窗口在创建缓冲池时读取一次，不合法的RMDB_SCAN_READAHEAD回退到默认值
+ */
+TEST(RecordManagerTest, ScanReadaheadConfigTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    for (const char *value : {"abc", "-1", "100000"}) {
+        setenv("RMDB_SCAN_READAHEAD", value, 1);
+        BufferPoolManager buffer_pool_manager(BUFFER_POOL_SIZE, disk_manager.get());
+        EXPECT_EQ(SCAN_READAHEAD_PAGES, buffer_pool_manager.get_scan_readahead());
+    }
+    setenv("RMDB_SCAN_READAHEAD", "8", 1);
+    BufferPoolManager buffer_pool_manager(BUFFER_POOL_SIZE, disk_manager.get());
+    unsetenv("RMDB_SCAN_READAHEAD");
+    EXPECT_EQ(8, buffer_pool_manager.get_scan_readahead());
+}
+
+// 吞吐量对比使用32MB的表，耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests
+TEST(RecordManagerTest, DISABLED_ColdScanBenchmark) { run_cold_scan("cold_scan_benchmark.txt", 8192); }
+
+/**
+ * @brief 分别用逐条扫描（RmScan::next后再get_record复制记录）与按页批量扫描（RmBatchScan::next_batch）读出整张表，
+ * 检查结果并比较两者的吞吐量
+ * @note 表在缓冲池中，扫描的开销主要是访问缓冲池的次数
+ */
+static void run_batch_scan(const std::string &filename, size_t num_records, int rounds) {
+    const int record_size = 16;
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+    rm_manager->create_file(filename, record_size);
+    auto file_handle = rm_manager->open_file(filename);
+    char buf[record_size] = {0};
+    for (size_t i = 0; i < num_records; i++) {
+        *reinterpret_cast<int *>(buf) = static_cast<int>(i);
+        file_handle->insert_record(buf, nullptr);
+    }
+
+    double row_ms = 0;
+    double batch_ms = 0;
+    for (int round = 0; round < rounds; round++) {
+        auto start = std::chrono::steady_clock::now();
+        size_t cnt = 0;
+        long long sum = 0;
+        for (RmScan scan(file_handle.get()); !scan.is_end(); scan.next()) {
+            auto rec = file_handle->get_record(scan.rid(), nullptr);
+            sum += *reinterpret_cast<int *>(rec->data);
+            cnt++;
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(num_records, cnt);
+        EXPECT_EQ(static_cast<long long>(num_records) * (num_records - 1) / 2, sum);
+        if (row_ms == 0 || ms < row_ms) row_ms = ms;
+
+        start = std::chrono::steady_clock::now();
+        cnt = 0;
+        sum = 0;
+        RmBatchScan scan(file_handle.get());
+        RmPageBatch batch;
+        while (scan.next_batch(&batch)) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                sum += *reinterpret_cast<const int *>(batch.record(i));
+                cnt++;
+            }
+        }
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(num_records, cnt);
+        EXPECT_EQ(static_cast<long long>(num_records) * (num_records - 1) / 2, sum);
+        if (batch_ms == 0 || ms < batch_ms) batch_ms = ms;
+    }
+    std::cout << "row at a time: " << num_records / row_ms / 1000 << " M rows/s (" << row_ms << " ms)" << std::endl;
+    std::cout << "page at a time: " << num_records / batch_ms / 1000 << " M rows/s (" << batch_ms << " ms)"
+              << std::endl;
+
+    rm_manager->close_file(file_handle.get());
+    disk_manager->destroy_file(filename);
+}
+
+TEST(RecordManagerTest, BatchScanTest) { run_batch_scan("batch_scan_test.txt", 10000, 1); }
+
+// 吞吐量对比使用100万条记录，耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests
+TEST(RecordManagerTest, DISABLED_BatchScanBenchmark) { run_batch_scan("batch_scan_benchmark.txt", 1000000, 3); }
+
+/**
+ * @brief 视图和批次只持有页面的pin，不持有页面锁：持有它们时在同一线程中写同一页面不会死锁
+ */
+TEST(RecordManagerTest, ViewHoldsPinOnlyTest) {
+    const std::string filename = "view_pin_only_test.txt";
+    const int record_size = 16;
+    auto disk_manager = std::make_unique<DiskManager>();
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+    rm_manager->create_file(filename, record_size);
+    auto file_handle = rm_manager->open_file(filename);
+    char buf[record_size] = {0};
+    Rid first = file_handle->insert_record(buf, nullptr);
+    Rid second = file_handle->insert_record(buf, nullptr);
+
+    RecordView view = file_handle->get_record_view(first, nullptr);
+    RmBatchScan scan(file_handle.get());
+    RmPageBatch batch;
+    ASSERT_TRUE(scan.next_batch(&batch));
+    ASSERT_EQ(first.page_no, batch.rid(0).page_no);
+
+    buf[0] = 'x';
+    file_handle->update_record(second, buf, nullptr);
+    file_handle->insert_record(buf, nullptr);
+    EXPECT_EQ('x', file_handle->get_record(second, nullptr)->data[0]);
+    EXPECT_EQ(0, view.data()[0]);
+
+    batch.release();
+    view = RecordView();
+    rm_manager->close_file(file_handle.get());
+    disk_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 测试从TupleArena分配数据的RmRecord
+ */
+TEST(RecordManagerTest, TupleArenaTest) {
+    TupleArena arena(1024);
+    char *a = arena.allocate(3);
+    char *b = arena.allocate(10);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(b) % 8);
+    EXPECT_EQ(a + 8, b);
+    char *large = arena.allocate(4096);  // 超过块大小，单独分配，不影响当前块
+    memset(large, 1, 4096);
+    EXPECT_EQ(b + 16, arena.allocate(8));
+    EXPECT_EQ(8u + 16 + 4096 + 8, arena.get_allocated_bytes());
+    arena.reset();
+    EXPECT_EQ(0u, arena.get_allocated_bytes());
+    EXPECT_EQ(a, arena.allocate(1));  // reset之后重用第一个块
+
+    char buf[24] = "arena record";
+    {
+        RmRecord rec(sizeof(buf), &arena);
+        memcpy(rec.data, buf, sizeof(buf));
+        RmRecord copy(rec);  // 复制得到的记录自己分配内存
+        EXPECT_NE(rec.data, copy.data);
+        EXPECT_EQ(0, memcmp(buf, copy.data, sizeof(buf)));
+        auto view_rec = RecordView(buf, sizeof(buf)).materialize(&arena);
+        EXPECT_EQ(0, memcmp(buf, view_rec->data, sizeof(buf)));
+    }
+}
+
+/**
+ * @brief 比较逐条分配与arena分配记录数据的开销，默认不运行，需要加--gtest_also_run_disabled_tests
+ * @note 一条语句产生的元组在语句结束时一起释放，只比较记录数据的分配
+ */
+TEST(RecordManagerTest, DISABLED_TupleArenaBenchmark) {
+    char buf[24] = "arena record";
+    const int num_records = 1000000;
+    const int record_size = 24;
+    double heap_ms;
+    double arena_ms;
+    {
+        std::vector<RmRecord> records;
+        records.reserve(num_records);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_records; i++) {
+            records.emplace_back(record_size);
+            memcpy(records.back().data, buf, record_size);
+        }
+        records.clear();
+        heap_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    {
+        std::vector<RmRecord> records;
+        records.reserve(num_records);
+        TupleArena query_arena;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_records; i++) {
+            records.emplace_back(record_size, &query_arena);
+            memcpy(records.back().data, buf, record_size);
+        }
+        records.clear();
+        query_arena.reset();
+        arena_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    std::cout << "heap records: " << heap_ms << " ms, arena records: " << arena_ms << " ms" << std::endl;
+}
+
+// 逐位检查的next_bit，作为Bitmap::next_bit的参照
+static int next_bit_by_bit(bool bit, const char *bm, int max_n, int curr) {
+    for (int i = curr + 1; i < max_n; i++) {
+        if (Bitmap::is_set(bm, i) == bit) {
+            return i;
+        }
+    }
+    return max_n;
+}
+
+/**
+ * @brief 与逐位检查的实现比较next_bit和count的结果
+ */
+TEST(RecordManagerTest, BitmapTest) {
+    srand((unsigned)time(nullptr));
+    char bm[128];
+    for (int round = 0; round < 500; round++) {
+        int max_n = 1 + rand() % (sizeof(bm) * BITMAP_WIDTH);
+        int density = rand() % 4;  // 0: 全0，1: 稀疏，2: 随机，3: 全1
+        rand_buf(sizeof(bm), bm);  // max_n之后的位是随机的，不应影响结果
+        int expected_count = 0;
+        for (int i = 0; i < max_n; i++) {
+            bool set = density == 3 || (density == 2 && rand() % 2 == 0) || (density == 1 && rand() % 64 == 0);
+            set ? Bitmap::set(bm, i) : Bitmap::reset(bm, i);
+            expected_count += set;
+        }
+        ASSERT_EQ(expected_count, Bitmap::count(bm, max_n));
+        for (bool bit : {false, true}) {
+            for (int curr = -1; curr < max_n; curr++) {
+                ASSERT_EQ(next_bit_by_bit(bit, bm, max_n, curr), Bitmap::next_bit(bit, bm, max_n, curr))
+                    << "bit " << bit << " max_n " << max_n << " curr " << curr;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 比较逐位检查与按字检查在页面位图上的速度，默认不运行，需要加--gtest_also_run_disabled_tests
+ */
+TEST(RecordManagerTest, DISABLED_BitmapBenchmark) {
+    // 一个记录大小为16字节的页面有约250个槽：扫描稀疏页面中的记录，在只剩最后一个空闲槽的页面中查找空闲槽
+    const int max_n = 250;
+    const int rounds = 200000;
+    char sparse[32] = {0};
+    char full[32] = {0};
+    for (int i = 0; i < max_n; i += 37) Bitmap::set(sparse, i);
+    for (int i = 0; i < max_n - 1; i++) Bitmap::set(full, i);
+    int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = next_bit_by_bit(true, sparse, max_n, -1); i < max_n; i = next_bit_by_bit(true, sparse, max_n, i)) {
+            sink++;
+        }
+        sink += next_bit_by_bit(false, full, max_n, -1);
+    }
+    double bit_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = Bitmap::first_bit(true, sparse, max_n); i < max_n; i = Bitmap::next_bit(true, sparse, max_n, i)) {
+            sink--;
+        }
+        sink -= Bitmap::first_bit(false, full, max_n);
+    }
+    double word_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(0, sink);
+    std::cout << "bit at a time: " << bit_ms << " ms, word at a time: " << word_ms << " ms" << std::endl;
+}
+
+/**
+ * @brief 分别逐条插入与批量插入num_records条窄记录，检查两者得到相同的布局，并比较两者的吞吐量
+ */
+static void run_bulk_insert(const std::string &filename, int num_records) {
+    const int record_size = 8;
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+    std::vector<char> buf(static_cast<size_t>(num_records) * record_size);
+    for (int i = 0; i < num_records; i++) {
+        *reinterpret_cast<int *>(&buf[static_cast<size_t>(i) * record_size]) = i;
+        *reinterpret_cast<int *>(&buf[static_cast<size_t>(i) * record_size + 4]) = -i;
+    }
+
+    double row_ms = 0;
+    double bulk_ms = 0;
+    for (bool bulk : {false, true}) {
+        if (disk_manager->is_file(filename)) {
+            disk_manager->destroy_file(filename);
+        }
+        rm_manager->create_file(filename, record_size);
+        auto file_handle = rm_manager->open_file(filename);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Rid> rids;
+        if (bulk) {
+            // 分成大小不一的几批，后一批先填满前一批留下的半满页面
+            int inserted = 0;
+            for (int batch : {1, 100, 12345, num_records}) {
+                batch = std::min(batch, num_records - inserted);
+                file_handle->insert_records(&buf[static_cast<size_t>(inserted) * record_size], batch, &rids, nullptr);
+                inserted += batch;
+            }
+        } else {
+            for (int i = 0; i < num_records; i++) {
+                rids.push_back(file_handle->insert_record(&buf[static_cast<size_t>(i) * record_size], nullptr));
+            }
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        (bulk ? bulk_ms : row_ms) = ms;
+
+        // 两种方式得到相同的布局：页面被依次填满
+        ASSERT_EQ(static_cast<size_t>(num_records), rids.size());
+        for (int i = 0; i < num_records; i++) {
+            ASSERT_EQ(1 + i / file_handle->file_hdr_.num_records_per_page, rids[i].page_no);
+            ASSERT_EQ(i % file_handle->file_hdr_.num_records_per_page, rids[i].slot_no);
+        }
+        int cnt = 0;
+        RmBatchScan scan(file_handle.get());
+        RmPageBatch batch;
+        while (scan.next_batch(&batch)) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                ASSERT_EQ(0, memcmp(batch.record(i), &buf[static_cast<size_t>(cnt) * record_size], record_size));
+                cnt++;
+            }
+        }
+        EXPECT_EQ(num_records, cnt);
+        // 页面的记录数与位图一致，删除后空出的槽位可以被批量插入重用
+        file_handle->delete_record(rids[5], nullptr);
+        std::vector<Rid> reused;
+        file_handle->insert_records(&buf[0], 1, &reused, nullptr);
+        EXPECT_EQ(rids[5], reused[0]);
+        rm_manager->close_file(file_handle.get());
+    }
+    std::cout << "row at a time: " << num_records / row_ms / 1000 << " M rows/s (" << row_ms << " ms)" << std::endl;
+    std::cout << "bulk insert: " << num_records / bulk_ms / 1000 << " M rows/s (" << bulk_ms << " ms)" << std::endl;
+    rm_manager->destroy_file(filename);
+}
+
+TEST(RecordManagerTest, BulkInsertTest) { run_bulk_insert("bulk_insert_test.txt", 20000); }
+
+// 吞吐量对比使用100万条记录，耗时较长，默认不运行，需要加--gtest_also_run_disabled_tests
+TEST(RecordManagerTest, DISABLED_BulkInsertBenchmark) { run_bulk_insert("bulk_insert_benchmark.txt", 1000000); }
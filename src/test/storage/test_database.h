@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <memory>
+
+#include "index/ix.h"
+#include "record/rm.h"
+#include "storage/buffer_pool_manager.h"
+#include "system/sm_manager.h"
+
+/**
+ * @description: 单元测试使用的存储层，在给定的DiskManager上创建缓冲池、RmManager、IxManager和SmManager，
+ * 析构时按创建的相反顺序销毁
+ */
+struct TestDatabase {
+    std::unique_ptr<BufferPoolManager> bpm;
+    std::unique_ptr<RmManager> rm_manager;
+    std::unique_ptr<IxManager> ix_manager;
+    SmManager sm;
+
+    explicit TestDatabase(DiskManager *disk_manager, size_t pool_size = BUFFER_POOL_SIZE)
+        : bpm(std::make_unique<BufferPoolManager>(pool_size, disk_manager)),
+          rm_manager(std::make_unique<RmManager>(disk_manager, bpm.get())),
+          ix_manager(std::make_unique<IxManager>(disk_manager, bpm.get())),
+          sm(disk_manager, bpm.get(), rm_manager.get(), ix_manager.get()) {}
+};
@@ -0,0 +1,90 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../storage/test_database.h"
+#include "execution/executor_insert.h"
+#include "gtest/gtest.h"
+#include "transaction/transaction_manager.h"
+
+const std::string TEST_DB_NAME = "RollbackTest_db";
+
+/**
+ * @brief 插入(a, b)形式的若干行，a列上有索引
+ */
+static Rid insert_rows(SmManager *sm_manager, Context *context, const std::vector<std::pair<int, int>> &rows) {
+    std::vector<Value> values;
+    for (auto &[a, b] : rows) {
+        Value va, vb;
+        va.set_int(a);
+        vb.set_int(b);
+        values.push_back(va);
+        values.push_back(vb);
+    }
+    InsertExecutor insert(sm_manager, "t", values, context);
+    insert.Next();
+    return insert.rid();
+}
+
+/**
+ * @brief 回滚插入时只删除本事务插入的索引项：键与已有记录重复的行没有插入索引项，
+ * 回滚时不能删除已有记录的索引项
+ */
+TEST(RollbackTest, DuplicateKeyKeepsExistingEntry) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    if (disk_manager->is_dir(TEST_DB_NAME)) {
+        disk_manager->destroy_dir(TEST_DB_NAME);
+    }
+    TestDatabase db(disk_manager.get());
+    SmManager *sm_manager = &db.sm;
+    sm_manager->create_db(TEST_DB_NAME);
+    sm_manager->open_db(TEST_DB_NAME);
+    LockManager lock_manager;
+    TransactionManager txn_manager(&lock_manager, sm_manager);
+    char data_send[BUFFER_LENGTH];
+    int offset = 0;
+    Context ddl_context(&lock_manager, nullptr, nullptr, data_send, &offset);
+    sm_manager->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, &ddl_context);
+    sm_manager->create_index("t", {"a"}, &ddl_context);
+    auto ih = sm_manager->ihs_.at(db.ix_manager->get_index_name("t", std::vector<std::string>{"a"})).get();
+    auto key_rid = [&](int key) {
+        std::vector<Rid> rids;
+        ih->get_value(reinterpret_cast<const char *>(&key), &rids, nullptr);
+        return rids;
+    };
+
+    Transaction *txn = txn_manager.begin(nullptr, nullptr);
+    Context context(&lock_manager, nullptr, txn, data_send, &offset);
+    Rid existing = insert_rows(sm_manager, &context, {{1, 10}});
+    txn_manager.commit(txn, nullptr);
+
+    // 单行插入（INSERT_TUPLE）与多行插入（INSERT_PAGE）中都有与已有记录重复的键
+    const std::vector<std::vector<std::pair<int, int>>> statements = {{{1, 20}}, {{2, 0}, {1, 30}, {3, 0}}};
+    for (auto &rows : statements) {
+        txn = txn_manager.begin(nullptr, nullptr);
+        Context abort_context(&lock_manager, nullptr, txn, data_send, &offset);
+        insert_rows(sm_manager, &abort_context, rows);
+        txn_manager.abort(txn, nullptr);
+
+        ASSERT_EQ(std::vector<Rid>{existing}, key_rid(1));
+        EXPECT_TRUE(key_rid(2).empty());
+        EXPECT_TRUE(key_rid(3).empty());
+        int num_records = 0;
+        for (RmScan scan(sm_manager->fhs_.at("t").get()); !scan.is_end(); scan.next()) {
+            num_records++;
+        }
+        EXPECT_EQ(1, num_records);
+    }
+    sm_manager->close_db();
+    disk_manager->destroy_dir(TEST_DB_NAME);
+}
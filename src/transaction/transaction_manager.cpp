@@ -32,6 +32,37 @@ void TransactionManager::commit(Transaction* txn, LogManager* log_manager) {
     txn->set_state(TransactionState::COMMITTED);
 }
 
+/**
+ * @description: 删除一条记录在表的所有索引中的索引项，用于回滚插入。
+ * 只删除指向rid的索引项：键重复时索引中的项属于另一条记录，不是这次写入的，不能删除
+ * @param {TabMeta&} tab_meta 记录所在的表
+ * @param {char*} rec 记录的内容
+ * @param {Rid&} rid 记录的位置
+ * @param {Transaction*} txn 当前事务
+ */
+void TransactionManager::delete_index_entries(const TabMeta &tab_meta, const char *rec, const Rid &rid,
+                                              Transaction *txn) {
+    for (auto& index : tab_meta.indexes) {
+        std::vector<std::string> col_names;
+        for(const auto& col : index.cols) col_names.push_back(col.name);
+        auto index_name = sm_manager_->get_ix_manager()->get_index_name(tab_meta.name, col_names);
+        if (sm_manager_->ihs_.find(index_name) == sm_manager_->ihs_.end()) continue;
+        auto ih = sm_manager_->ihs_.at(index_name).get();
+
+        char* key = new char[index.col_tot_len];
+        int offset = 0;
+        for (auto& col : index.cols) {
+            memcpy(key + offset, rec + col.offset, col.len);
+            offset += col.len;
+        }
+        std::vector<Rid> rids;
+        if (ih->get_value(key, &rids, txn) && rids.front() == rid) {
+            ih->delete_entry(key, txn);
+        }
+        delete[] key;
+    }
+}
+
 void TransactionManager::abort(Transaction * txn, LogManager *log_manager) {
     auto write_set = txn->get_write_set();
 
@@ -42,31 +73,27 @@ void TransactionManager::abort(Transaction * txn, LogManager *log_manager) {
         auto wr = (*write_set)[i]; // 使用下标访问
         
         auto *file_handle = sm_manager_->fhs_.at(wr->GetTableName()).get();
-        auto tab_meta = sm_manager_->db_.get_table(wr->GetTableName());
+        // TabMeta的复制构造函数不复制indexes，这里必须用引用
+        const TabMeta &tab_meta = sm_manager_->db_.get_table(wr->GetTableName());
 
         // 1. INSERT 回滚
         if (wr->GetWriteType() == WType::INSERT_TUPLE) {
-            // 先删索引
-            for (auto& index : tab_meta.indexes) {
-                std::vector<std::string> col_names;
-                for(const auto& col : index.cols) col_names.push_back(col.name);
-                auto index_name = sm_manager_->get_ix_manager()->get_index_name(wr->GetTableName(), col_names);
-                if (sm_manager_->ihs_.find(index_name) == sm_manager_->ihs_.end()) continue;
-                auto ih = sm_manager_->ihs_.at(index_name).get();
-                
-                char* key = new char[index.col_tot_len];
-                int offset = 0;
-                for (auto& col : index.cols) {
-                    memcpy(key + offset, wr->GetRecord().data + col.offset, col.len);
-                    offset += col.len;
-                }
-                ih->delete_entry(key, txn);
-                delete[] key;
-            }
-            // 再删数据
+            // 先删索引，再删数据
+            delete_index_entries(tab_meta, wr->GetRecord().data, wr->GetRid(), txn);
             file_handle->delete_record(wr->GetRid(), nullptr);
         }
         
+        // 1.1 批量INSERT 回滚，逐条删除同一页面中插入的记录
+        else if (wr->GetWriteType() == WType::INSERT_PAGE) {
+            const int record_size = file_handle->get_file_hdr().record_size;
+            auto &slot_nos = wr->GetSlotNos();
+            for (int j = static_cast<int>(slot_nos.size()) - 1; j >= 0; j--) {
+                Rid rid{wr->GetRid().page_no, slot_nos[j]};
+                delete_index_entries(tab_meta, wr->GetRecord().data + static_cast<size_t>(j) * record_size, rid, txn);
+                file_handle->delete_record(rid, nullptr);
+            }
+        }
+
         // 2. DELETE 回滚
         else if (wr->GetWriteType() == WType::DELETE_TUPLE) {
             // 先插数据
@@ -71,4 +71,6 @@ private:
     std::mutex latch_;  // 用于txn_map的并发
     SmManager *sm_manager_;
     LockManager *lock_manager_;
+
+    void delete_index_entries(const TabMeta &tab_meta, const char *rec, const Rid &rid, Transaction *txn);
 };
\ No newline at end of file
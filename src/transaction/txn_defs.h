@@ -11,6 +11,7 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <atomic>
+#include <vector>
 
 #include "common/config.h"
 #include "defs.h"
@@ -22,8 +23,8 @@ enum class TransactionState { DEFAULT, GROWING, SHRINKING, COMMITTED, ABORTED };
 /* 系统的隔离级别，当前赛题中为可串行化隔离级别 */
 enum class IsolationLevel { READ_UNCOMMITTED, REPEATABLE_READ, READ_COMMITTED, SERIALIZABLE };
 
-/* 事务写操作类型，包括插入、删除、更新三种操作 */
-enum class WType { INSERT_TUPLE = 0, DELETE_TUPLE, UPDATE_TUPLE};
+/* 事务写操作类型，包括插入、删除、更新三种操作，以及批量插入在同一个页面中的多条记录 */
+enum class WType { INSERT_TUPLE = 0, DELETE_TUPLE, UPDATE_TUPLE, INSERT_PAGE};
 
 /**
  * @brief 事务的写操作记录，用于事务的回滚
@@ -35,6 +36,10 @@ enum class WType { INSERT_TUPLE = 0, DELETE_TUPLE, UPDATE_TUPLE};
  * ----------------------------------------------
  * | wtype | tab_name | tuple_rid | tuple_value |
  * ----------------------------------------------
+ * INSERT_PAGE (rid的slot_no为-1，tuple_values为按slot_nos顺序连续存放的记录)
+ * --------------------------------------------------------------
+ * | wtype | tab_name | page_rid | slot_nos | tuple_values |
+ * --------------------------------------------------------------
  */
 class WriteRecord {
    public:
@@ -48,6 +53,11 @@ class WriteRecord {
     WriteRecord(WType wtype, const std::string &tab_name, const Rid &rid, const RmRecord &record)
         : wtype_(wtype), tab_name_(tab_name), rid_(rid), record_(record) {}
 
+    // constructor for bulk insert operation
+    WriteRecord(WType wtype, const std::string &tab_name, int page_no, std::vector<int> slot_nos,
+                const RmRecord &records)
+        : wtype_(wtype), tab_name_(tab_name), rid_{page_no, -1}, slot_nos_(std::move(slot_nos)), record_(records) {}
+
     ~WriteRecord() = default;
 
     inline RmRecord &GetRecord() { return record_; }
@@ -58,10 +68,13 @@ class WriteRecord {
 
     inline std::string &GetTableName() { return tab_name_; }
 
+    inline std::vector<int> &GetSlotNos() { return slot_nos_; }
+
    private:
     WType wtype_;
     std::string tab_name_;
     Rid rid_;
+    std::vector<int> slot_nos_;
     RmRecord record_;
 };
 